@@ -0,0 +1,136 @@
+#include <pthread.h> // before the engine headers: on Windows it can pull in windows.h and its SIZE type
+#include <string.h>
+#include "ai_worker.h"
+
+// Handoff state, all guarded by lock. generation numbers the requests: an answer is only delivered
+// if no newer request or cancel came in while it was being computed
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static pthread_t worker;
+static int running = 0, quitting = 0;
+static unsigned long generation = 0;
+static int hasRequest = 0, hasAnswer = 0, thinking = 0;
+static AiRequest pending;     // next request for the worker
+static Move answer;
+static SearchStats answerStats;
+static atomic_int stopSearch; // tells a running m,n,k search to give up
+
+static AiRequest active;     // worker thread only: the request being computed
+static SearchContext search; // worker thread only once started: the 3x3 engine's state
+static MctsContext mcts;     // worker thread only: MCTS trees, allocated on first use
+
+static Move computeMove(AiRequest *r, SearchStats *stats) {
+    switch (r->engine) {
+    case AI_MNK:
+        r->options.stop = &stopSearch;
+        return mnkFindBestMove(&r->rules, r->board, r->difficulty, &r->options, stats);
+    case AI_MCTS:
+        r->options.stop = &stopSearch;
+        if (!mcts.treeCount && !mctsInit(&mcts, 1)) // out of memory: the alpha-beta search still plays
+            return mnkFindBestMove(&r->rules, r->board, r->difficulty, &r->options, stats);
+        if (r->newGame) mctsNewGame(&mcts);
+        return mctsFindBestMove(&mcts, &r->rules, r->board, r->difficulty, &r->options, stats);
+    case AI_NAIVE_BAYES: {
+        unsigned long long start = metricsNowNs();
+        Move move = nbFindBestMove(r->model, (char (*)[SIZE])r->board);
+        memset(stats, 0, sizeof(*stats));
+        metricsFinish(stats, start);
+        return move;
+    }
+    default:
+        if (r->newGame) searchContextNewGame(&search);
+        search.difficulty = r->difficulty;
+        Move move = findBestMove(&search, (char (*)[SIZE])r->board);
+        *stats = search.stats;
+        return move;
+    }
+}
+
+static void *workerMain(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (!hasRequest && !quitting) pthread_cond_wait(&wake, &lock);
+        if (quitting) break;
+        active = pending;
+        hasRequest = 0;
+        unsigned long id = generation;
+        atomic_store(&stopSearch, 0);
+        pthread_mutex_unlock(&lock);
+
+        SearchStats stats;
+        Move move = computeMove(&active, &stats);
+
+        pthread_mutex_lock(&lock);
+        if (id == generation) { // still wanted
+            answer = move;
+            answerStats = stats;
+            hasAnswer = 1;
+        }
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+void aiWorkerStart(unsigned long long seed) {
+    if (running) return;
+    searchContextInit(&search, 'O', 3, seed); // before the thread exists, so no lock needed
+    quitting = 0;
+    atomic_init(&stopSearch, 0);
+    running = pthread_create(&worker, NULL, workerMain, NULL) == 0;
+}
+
+void aiWorkerStop(void) {
+    if (!running) return;
+    pthread_mutex_lock(&lock);
+    quitting = 1;
+    generation++;
+    atomic_store(&stopSearch, 1);
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    pthread_join(worker, NULL);
+    mctsFree(&mcts);
+    running = 0;
+}
+
+void aiRequestMove(const AiRequest *request) {
+    pthread_mutex_lock(&lock);
+    generation++;
+    pending = *request;
+    hasRequest = 1;
+    hasAnswer = 0;
+    thinking = 1;
+    atomic_store(&stopSearch, 1); // a search for an older request is not wanted any more
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+}
+
+int aiPollMove(Move *move, SearchStats *stats) {
+    pthread_mutex_lock(&lock);
+    int ready = hasAnswer;
+    if (ready) {
+        *move = answer;
+        if (stats) *stats = answerStats;
+        hasAnswer = 0;
+        thinking = 0;
+    }
+    pthread_mutex_unlock(&lock);
+    return ready;
+}
+
+void aiCancel(void) {
+    pthread_mutex_lock(&lock);
+    generation++;
+    hasRequest = 0;
+    hasAnswer = 0;
+    thinking = 0;
+    atomic_store(&stopSearch, 1);
+    pthread_mutex_unlock(&lock);
+}
+
+int aiThinking(void) {
+    pthread_mutex_lock(&lock);
+    int busy = thinking;
+    pthread_mutex_unlock(&lock);
+    return busy;
+}
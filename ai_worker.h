@@ -0,0 +1,30 @@
+#ifndef AI_WORKER_H
+#define AI_WORKER_H
+
+#include "mnk.h"
+#include "mcts.h"
+#include "naive_bayes.h"
+
+// Background thread that computes the AI's moves so the game loop never blocks on a search.
+// The game posts a request, keeps drawing, and polls once per frame until the answer is in.
+typedef enum { AI_MINIMAX, AI_MNK, AI_NAIVE_BAYES, AI_MCTS } AiEngine;
+
+typedef struct {
+    AiEngine engine;
+    char board[MNK_MAX_CELLS];      // copied, so the game can change its own board meanwhile
+    MnkRules rules;                 // AI_MNK and AI_MCTS
+    MnkOptions options;             // AI_MNK and AI_MCTS; the worker supplies the stop flag
+    int difficulty;                 // AI_MINIMAX, AI_MNK and AI_MCTS
+    const NaiveBayesModel *model;   // AI_NAIVE_BAYES
+    int newGame;                    // clear the transposition table (AI_MCTS: the trees) before searching
+} AiRequest;
+
+void aiWorkerStart(unsigned long long seed); // seed for the 3x3 engine's random choices
+void aiWorkerStop(void);
+
+void aiRequestMove(const AiRequest *request); // replaces (and cancels) any request still in flight
+int aiPollMove(Move *move, SearchStats *stats); // 1 once the latest request is answered; the answer is handed out once
+void aiCancel(void); // drop the request in flight, its answer is never delivered
+int aiThinking(void); // 1 between aiRequestMove() and the aiPollMove() that returns its answer
+
+#endif
@@ -0,0 +1,253 @@
+// Game log analyzer: replays every 3x3 game of a game log (game_log.h) against the perfect-play tablebase and
+// reports, per mode and difficulty, the results and how often each side played an optimal move or a blunder
+// Build and run:  gcc -O2 analyze_log.c game_log.c threadpool.c metrics.c -lpthread -lm -o analyze_log
+//                 ./analyze_log [games.log]
+// A move is optimal if the tablebase lists it for the position. It is a blunder if it gives up value: a won
+// position no longer won, or a drawn one lost. Larger boards have no tablebase, so their games are only counted
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "game_log.h"
+#include "metrics.h"
+#include "tablebase.h"
+#include "threadpool.h"
+
+#define CHUNK_BYTES (256 * 1024) // log bytes per task, about 65000 3x3 games
+#define MODES 4
+#define LEVELS 4
+
+static const char *modeNames[MODES] = { "two-player", "minimax", "naive-bayes", "mcts" };
+static const char *levelNames[LEVELS] = { "-", "easy", "medium", "hard" };
+static const int pow3[9] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+
+typedef struct {
+    long games, xWins, draws, oWins, unfinished;
+    long moves[2], optimal[2], blunders[2]; // [0] the human (both players in two-player games), [1] the AI
+} Tally;
+
+// One task: the whole records in data, scored into its own tallies so no two threads share a counter
+typedef struct {
+    unsigned char data[CHUNK_BYTES];
+    size_t size;
+    Tally tally[MODES][LEVELS];
+    long larger, damaged;
+} Chunk;
+
+// Replays one game. Returns 0 without touching the tallies if the moves don't make a legal game
+static int scoreGame(const GameRecord *game, Tally *t) {
+    Tally add;
+    memset(&add, 0, sizeof(add));
+    int index = 0;
+    char mark = game->firstMark;
+    for (int i = 0; i < game->moveCount; i++) {
+        int cell = game->moves[i], side = (mark == 'O');
+        unsigned short entry = tablebase[side][index];
+        if (TB_VALUE(entry) == TB_UNSOLVED || TB_MOVES(entry) == 0) return 0; // unreachable, or already over
+        index += (mark == 'X' ? 1 : 2) * pow3[cell];
+
+        // The child's value is for the opponent, flip it to get what the move kept for the mover
+        int child = TB_VALUE(tablebase[!side][index]);
+        int kept = (child == TB_WIN) ? TB_LOSS : (child == TB_LOSS) ? TB_WIN : TB_DRAW;
+        int player = game->mode != 0 && mark == 'O';
+        add.moves[player]++;
+        add.optimal[player] += (TB_MOVES(entry) >> cell) & 1;
+        add.blunders[player] += kept < (int)TB_VALUE(entry);
+        mark = (mark == 'X') ? 'O' : 'X';
+    }
+
+    // After the last move: a finished game is 0 plies from the end, lost for the side to move unless drawn
+    unsigned short last = tablebase[mark == 'O'][index];
+    if (TB_DIST(last) != 0) add.unfinished = 1;
+    else if (TB_VALUE(last) == TB_DRAW) add.draws = 1;
+    else if (mark == 'O') add.xWins = 1;
+    else add.oWins = 1;
+
+    t->games++;
+    t->xWins += add.xWins;
+    t->draws += add.draws;
+    t->oWins += add.oWins;
+    t->unfinished += add.unfinished;
+    for (int p = 0; p < 2; p++) {
+        t->moves[p] += add.moves[p];
+        t->optimal[p] += add.optimal[p];
+        t->blunders[p] += add.blunders[p];
+    }
+    return 1;
+}
+
+static void scoreChunk(void *arg) {
+    Chunk *c = arg;
+    GameRecord game;
+    for (size_t at = 0; at < c->size;) {
+        int size = gameLogRecordSize(c->data + at, c->size - at);
+        if (gameLogDecode(c->data + at, (size_t)size, &game) != size) c->damaged++;
+        else if (game.width != 3 || game.height != 3 || game.k != 3) c->larger++;
+        else if (!scoreGame(&game, &c->tally[game.mode][game.difficulty])) c->damaged++;
+        at += (size_t)size;
+    }
+}
+
+// 95% Wilson score interval of a proportion
+static void wilson(long k, long n, double *low, double *high) {
+    const double z = 1.96;
+    double p = (double)k / n, z2n = z * z / n;
+    double center = (p + z2n / 2) / (1 + z2n);
+    double half = z * sqrt(p * (1 - p) / n + z2n / (4.0 * n)) / (1 + z2n);
+    *low = center - half;
+    *high = center + half;
+}
+
+static void addTally(Tally *to, const Tally *from) {
+    to->games += from->games;
+    to->xWins += from->xWins;
+    to->draws += from->draws;
+    to->oWins += from->oWins;
+    to->unfinished += from->unfinished;
+    for (int p = 0; p < 2; p++) {
+        to->moves[p] += from->moves[p];
+        to->optimal[p] += from->optimal[p];
+        to->blunders[p] += from->blunders[p];
+    }
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [--threads N] [--format text|csv|json] [log]\n", prog);
+    printf("  log defaults to games.log; --threads 0 uses one thread per core\n");
+}
+
+int main(int argc, char **argv) {
+    const char *path = "games.log";
+    int threads = 0;
+    MetricsFormat format = METRICS_TEXT;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "csv") == 0) format = METRICS_CSV;
+            else if (strcmp(argv[i], "json") == 0) format = METRICS_JSON;
+            else if (strcmp(argv[i], "text") == 0) format = METRICS_TEXT;
+            else { usage(argv[0]); return 1; }
+        } else if (argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        printf("Unable to open %s\n", path);
+        return 1;
+    }
+    unsigned char header[GAME_LOG_HEADER_BYTES];
+    if (fread(header, 1, sizeof(header), fp) != sizeof(header) || memcmp(header, GAME_LOG_MAGIC, 4) != 0 ||
+        header[4] != GAME_LOG_VERSION) {
+        printf("%s is not a version %d game log\n", path, GAME_LOG_VERSION);
+        fclose(fp);
+        return 1;
+    }
+
+    // The log is streamed: a few chunks are read, scored in parallel, added up, and their buffers reused
+    poolInit(threads);
+    int inFlight = 2 * poolThreadCount();
+    Chunk *chunks = malloc((size_t)inFlight * sizeof(Chunk));
+    if (!chunks) {
+        printf("Out of memory\n");
+        return 1;
+    }
+    Tally totals[MODES][LEVELS];
+    memset(totals, 0, sizeof(totals));
+    long larger = 0, damaged = 0;
+    unsigned char carry[GAME_LOG_MAX_RECORD]; // a record cut in two by the end of a chunk
+    size_t carried = 0;
+    unsigned long long start = metricsNowNs();
+    TaskGroup group;
+    taskGroupInit(&group);
+
+    for (int used = 0, done = 0; !done;) {
+        Chunk *c = &chunks[used++];
+        memset(c->tally, 0, sizeof(c->tally));
+        c->larger = c->damaged = 0;
+        memcpy(c->data, carry, carried);
+        size_t read = fread(c->data + carried, 1, CHUNK_BYTES - carried, fp);
+        size_t size = carried + read, whole = 0;
+        for (int n; (n = gameLogRecordSize(c->data + whole, size - whole)) > 0;) whole += (size_t)n;
+        carried = size - whole;
+        memcpy(carry, c->data + whole, carried);
+        c->size = whole;
+        done = (read == 0);
+        if (done && carried) damaged++; // the log ends inside a record
+        poolSpawn(&group, scoreChunk, c);
+
+        if (used == inFlight || done) {
+            poolWait(&group);
+            for (int i = 0; i < used; i++) {
+                for (int m = 0; m < MODES; m++)
+                    for (int l = 0; l < LEVELS; l++) addTally(&totals[m][l], &chunks[i].tally[m][l]);
+                larger += chunks[i].larger;
+                damaged += chunks[i].damaged;
+            }
+            used = 0;
+        }
+    }
+    fclose(fp);
+    double seconds = (metricsNowNs() - start) / 1e9;
+
+    if (format == METRICS_CSV)
+        printf("mode,level,player,games,x_wins,draws,o_wins,unfinished,moves,optimal,blunders,blunder_low,"
+               "blunder_high\n");
+    else if (format == METRICS_TEXT)
+        printf("%-11s %-6s %-6s %9s %7s %7s %7s %10s %8s %24s\n", "mode", "level", "player", "games", "X wins",
+               "draws", "O wins", "moves", "optimal", "blunders [95% CI]");
+
+    long games = 0;
+    for (int m = 0; m < MODES; m++) {
+        for (int l = 0; l < LEVELS; l++) {
+            const Tally *t = &totals[m][l];
+            games += t->games;
+            for (int p = 0; p < 2; p++) {
+                if (!t->moves[p]) continue;
+                const char *player = (m == 0) ? "both" : p ? "ai" : "human";
+                double low, high;
+                wilson(t->blunders[p], t->moves[p], &low, &high);
+                double optimal = 100.0 * t->optimal[p] / t->moves[p], blunders = 100.0 * t->blunders[p] / t->moves[p];
+                switch (format) {
+                case METRICS_CSV:
+                    printf("%s,%s,%s,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%.6f,%.6f\n", modeNames[m], levelNames[l],
+                           player, t->games, t->xWins, t->draws, t->oWins, t->unfinished, t->moves[p], t->optimal[p],
+                           t->blunders[p], low, high);
+                    break;
+                case METRICS_JSON:
+                    printf("{\"mode\":\"%s\",\"level\":\"%s\",\"player\":\"%s\",\"games\":%ld,\"x_wins\":%ld,"
+                           "\"draws\":%ld,\"o_wins\":%ld,\"unfinished\":%ld,\"moves\":%ld,\"optimal\":%ld,"
+                           "\"blunders\":%ld,\"blunder_ci\":[%.6f,%.6f]}\n", modeNames[m], levelNames[l], player,
+                           t->games, t->xWins, t->draws, t->oWins, t->unfinished, t->moves[p], t->optimal[p],
+                           t->blunders[p], low, high);
+                    break;
+                default: {
+                    char rate[32];
+                    snprintf(rate, sizeof(rate), "%5.1f%% [%5.1f, %5.1f]", blunders, 100 * low, 100 * high);
+                    printf("%-11s %-6s %-6s %9ld %7ld %7ld %7ld %10ld %7.1f%% %24s\n", modeNames[m], levelNames[l],
+                           player, t->games, t->xWins, t->draws, t->oWins, t->moves[p], optimal, rate);
+                    break;
+                }
+                }
+            }
+        }
+    }
+
+    if (format == METRICS_JSON)
+        printf("{\"games\":%ld,\"larger_boards\":%ld,\"damaged\":%ld,\"threads\":%d,\"seconds\":%.3f,"
+               "\"games_per_sec\":%.0f}\n", games, larger, damaged, poolThreadCount(), seconds,
+               (games + larger) / seconds);
+    else if (format == METRICS_TEXT)
+        printf("\n%ld games scored, %ld on larger boards, %ld damaged records; %d threads, %.2lf s: %.0f games/s\n",
+               games, larger, damaged, poolThreadCount(), seconds, (games + larger) / seconds);
+
+    poolShutdown();
+    free(chunks);
+    return 0;
+}
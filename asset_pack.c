@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h> // raylib.h can't be included next to this, so the pack reader stays raylib-free
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include "asset_pack.h"
+
+// Bits per pixel of raylib's uncompressed PixelFormat values, 1 (grayscale) to 13 (R16G16B16A16). raylib.h can't
+// be included here; the compressed formats after them never come out of pack_assets.c
+static const int pixelBits[] = { 0, 8, 16, 16, 24, 16, 16, 32, 32, 96, 128, 16, 48, 64 };
+#define MAX_IMAGE_SIDE 16384
+
+// Data bytes the entry's header fields describe, -1 if they don't describe anything the game can load. The game
+// hands these fields to raylib with a pointer into the mapping, so size has to match them exactly
+static int64_t expectedSize(const AssetEntry *e) {
+    switch (e->kind) {
+    case ASSET_IMAGE:
+        if (e->width <= 0 || e->width > MAX_IMAGE_SIDE || e->height <= 0 || e->height > MAX_IMAGE_SIDE ||
+            e->format <= 0 || e->format >= (int32_t)(sizeof(pixelBits) / sizeof(pixelBits[0])))
+            return -1;
+        return (int64_t)e->width * e->height * pixelBits[e->format] / 8;
+    case ASSET_SOUND: // 16-bit samples
+        if (e->sampleRate <= 0 || e->channels < 1 || e->channels > 2 || e->frameCount < 0) return -1;
+        return (int64_t)e->frameCount * e->channels * 2;
+    default:
+        return -1;
+    }
+}
+
+// The mapping is only used if the header matches this build, every entry lies inside the file and its size is
+// the one its header implies
+static int validPack(const AssetPackHeader *header, size_t size) {
+    if (size < sizeof(AssetPackHeader) || memcmp(header->magic, ASSET_PACK_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != ASSET_PACK_VERSION || header->count < 0 || header->count > ASSET_PACK_MAX_ENTRIES)
+        return 0;
+    for (int i = 0; i < header->count; i++) {
+        const AssetEntry *e = &header->entries[i];
+        if (e->offset < (int64_t)sizeof(AssetPackHeader) || e->size < 0 || e->offset % ASSET_PACK_ALIGN != 0 ||
+            (uint64_t)e->offset + (uint64_t)e->size > size || memchr(e->name, '\0', sizeof(e->name)) == NULL ||
+            e->size != expectedSize(e))
+            return 0;
+    }
+    return 1;
+}
+
+int assetPackMap(AssetPack *pack, const char *path) {
+    pack->header = NULL;
+    pack->size = 0;
+    const void *view = NULL;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return 0;
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            size = (size_t)fileSize.QuadPart;
+            CloseHandle(mapping); // the view keeps the mapping alive
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    off_t fileSize = lseek(fd, 0, SEEK_END);
+    if (fileSize > 0) {
+        void *mapped = mmap(NULL, (size_t)fileSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED) {
+            view = mapped;
+            size = (size_t)fileSize;
+        }
+    }
+    close(fd); // the mapping stays valid after the descriptor is closed
+#endif
+    if (!view) return 0;
+    pack->header = view;
+    pack->size = size;
+    if (!validPack(pack->header, size)) {
+        printf("%s is damaged or not a version %d asset pack\n", path, ASSET_PACK_VERSION);
+        assetPackUnmap(pack);
+        return 0;
+    }
+    return 1;
+}
+
+void assetPackUnmap(AssetPack *pack) {
+    if (!pack->header) return;
+#ifdef _WIN32
+    UnmapViewOfFile(pack->header);
+#else
+    munmap((void *)pack->header, pack->size);
+#endif
+    pack->header = NULL;
+    pack->size = 0;
+}
+
+const AssetEntry *assetPackFind(const AssetPack *pack, const char *name) {
+    if (!pack->header) return NULL;
+    for (int i = 0; i < pack->header->count; i++)
+        if (strcmp(pack->header->entries[i].name, name) == 0) return &pack->header->entries[i];
+    return NULL;
+}
+
+const void *assetPackData(const AssetPack *pack, const AssetEntry *entry) {
+    return (const char *)pack->header + entry->offset;
+}
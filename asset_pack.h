@@ -0,0 +1,48 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Asset pack: the game's images and sounds already decoded, in one file that is memory-mapped at startup.
+// Pixels and samples are handed to the GPU / audio device straight from the mapping, nothing is decoded.
+// pack_assets.c writes it at build time
+#define ASSET_PACK_MAGIC "TTAP"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_MAX_ENTRIES 16
+#define ASSET_PACK_ALIGN 64 // every entry's data starts at a multiple of this
+
+typedef enum { ASSET_IMAGE = 1, ASSET_SOUND = 2 } AssetKind;
+
+// Layout is the file format (little-endian, no padding)
+typedef struct {
+    char name[32];         // path of the source file, e.g. "Graphics/background.png"
+    int32_t kind;          // AssetKind
+    int32_t width, height; // ASSET_IMAGE
+    int32_t format;        // ASSET_IMAGE: raylib PixelFormat of the data
+    int32_t sampleRate;    // ASSET_SOUND: 16-bit samples, channels interleaved
+    int32_t channels;
+    int32_t frameCount;
+    int32_t reserved;
+    int64_t offset, size;  // data bytes, from the start of the file
+} AssetEntry;
+
+typedef struct {
+    char magic[4];  // ASSET_PACK_MAGIC
+    int32_t version; // ASSET_PACK_VERSION
+    int32_t count;
+    int32_t reserved;
+    AssetEntry entries[ASSET_PACK_MAX_ENTRIES];
+} AssetPackHeader;
+
+typedef struct {
+    const AssetPackHeader *header; // NULL when nothing is mapped
+    size_t size;
+} AssetPack;
+
+int assetPackMap(AssetPack *pack, const char *path); // read-only mapping, 1 if the file exists and is valid
+void assetPackUnmap(AssetPack *pack);
+const AssetEntry *assetPackFind(const AssetPack *pack, const char *name); // NULL if the pack has no such asset
+const void *assetPackData(const AssetPack *pack, const AssetEntry *entry);
+
+#endif
@@ -0,0 +1,239 @@
+#include <string.h>
+#include "batch_eval.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+#define FULL_MASK 0x1FF
+#define CENTER_MASK 0x010
+#define CORNER_MASK 0x145
+#define CHUNK 256 // boards converted to SoA at a time by evaluateBoards()
+
+// Same line order as minimax_improved.c: rows, columns, diagonals
+static const unsigned short lineMasks[8] = { 0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054 };
+
+static BatchKernel requestedKernel = BATCH_AUTO;
+
+// ---------------- Scalar ----------------
+static int hasLine(unsigned short bits) {
+    for (int i = 0; i < 8; i++)
+        if ((bits & lineMasks[i]) == lineMasks[i]) return 1;
+    return 0;
+}
+
+// Positional weights center 5, corners 3, edges 2, written as 2 per mark + 1 for center/corners + 2 for center
+static int positional(unsigned short v) {
+    return 2 * __builtin_popcount(v) + __builtin_popcount(v & (CENTER_MASK | CORNER_MASK)) + 2 * ((v >> 4) & 1);
+}
+
+static void scalarRange(const BoardBatch *b, size_t begin, size_t end, int difficulty, short *score, unsigned char *status) {
+    for (size_t i = begin; i < end; i++) {
+        unsigned short x = b->x[i], o = b->o[i];
+        unsigned short me = b->oToMove[i] ? o : x, them = b->oToMove[i] ? x : o;
+        int xWon = hasLine(x), oWon = hasLine(o);
+        status[i] = (unsigned char)((xWon ? BATCH_X_WON : 0) | (oWon ? BATCH_O_WON : 0) |
+                                    (((x | o) & FULL_MASK) == FULL_MASK ? BATCH_FULL : 0));
+
+        int s;
+        if (difficulty == 3) {
+            s = hasLine(me) ? 10 : hasLine(them) ? -10 : 0;
+        } else {
+            s = positional(me) - positional(them);
+            if (difficulty >= 2) {
+                for (int l = 0; l < 8; l++) {
+                    int meN = __builtin_popcount(me & lineMasks[l]), themN = __builtin_popcount(them & lineMasks[l]);
+                    if (meN == 2 && themN == 0) s += 10;
+                    if (themN == 2 && meN == 0) s -= 8;
+                }
+            }
+        }
+        score[i] = (short)s;
+    }
+}
+
+#ifdef BATCH_X86
+// ---------------- SSE2: 8 boards per register, one 16-bit lane each ----------------
+__attribute__((target("sse2"))) static inline __m128i popCount8(__m128i v) {
+    v = _mm_sub_epi16(v, _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi16(0x5555)));
+    v = _mm_add_epi16(_mm_and_si128(v, _mm_set1_epi16(0x3333)), _mm_and_si128(_mm_srli_epi16(v, 2), _mm_set1_epi16(0x3333)));
+    v = _mm_and_si128(_mm_add_epi16(v, _mm_srli_epi16(v, 4)), _mm_set1_epi16(0x0F0F));
+    return _mm_and_si128(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), _mm_set1_epi16(0x1F));
+}
+
+__attribute__((target("sse2"))) static inline __m128i positional8(__m128i v) {
+    __m128i s = _mm_slli_epi16(popCount8(v), 1);
+    s = _mm_add_epi16(s, popCount8(_mm_and_si128(v, _mm_set1_epi16(CENTER_MASK | CORNER_MASK))));
+    return _mm_add_epi16(s, _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi16(1)), 1));
+}
+
+__attribute__((target("sse2")))
+static size_t sse2Range(const BoardBatch *b, size_t n, int difficulty, short *score, unsigned char *status) {
+    const __m128i zero = _mm_setzero_si128(), ones = _mm_set1_epi16(-1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(b->x + i));
+        __m128i o = _mm_loadu_si128((const __m128i *)(b->o + i));
+        __m128i turn = _mm_sub_epi16(zero, _mm_loadu_si128((const __m128i *)(b->oToMove + i))); // all ones: O to move
+        __m128i me = _mm_or_si128(_mm_and_si128(turn, o), _mm_andnot_si128(turn, x));
+        __m128i them = _mm_or_si128(_mm_and_si128(turn, x), _mm_andnot_si128(turn, o));
+
+        __m128i xWon = zero, oWon = zero;
+        for (int l = 0; l < 8; l++) {
+            __m128i line = _mm_set1_epi16((short)lineMasks[l]);
+            xWon = _mm_or_si128(xWon, _mm_cmpeq_epi16(_mm_and_si128(x, line), line));
+            oWon = _mm_or_si128(oWon, _mm_cmpeq_epi16(_mm_and_si128(o, line), line));
+        }
+        __m128i full = _mm_cmpeq_epi16(_mm_or_si128(x, o), _mm_set1_epi16(FULL_MASK));
+        __m128i flags = _mm_or_si128(_mm_and_si128(xWon, _mm_set1_epi16(BATCH_X_WON)),
+                        _mm_or_si128(_mm_and_si128(oWon, _mm_set1_epi16(BATCH_O_WON)), _mm_and_si128(full, _mm_set1_epi16(BATCH_FULL))));
+        _mm_storel_epi64((__m128i *)(status + i), _mm_packus_epi16(flags, zero));
+
+        __m128i s;
+        if (difficulty == 3) {
+            __m128i meWon = _mm_or_si128(_mm_and_si128(turn, oWon), _mm_andnot_si128(turn, xWon));
+            __m128i themWon = _mm_andnot_si128(meWon, _mm_or_si128(_mm_and_si128(turn, xWon), _mm_andnot_si128(turn, oWon)));
+            s = _mm_sub_epi16(_mm_and_si128(meWon, _mm_set1_epi16(10)), _mm_and_si128(themWon, _mm_set1_epi16(10)));
+        } else {
+            s = _mm_sub_epi16(positional8(me), positional8(them));
+            if (difficulty >= 2) {
+                for (int l = 0; l < 8; l++) {
+                    __m128i line = _mm_set1_epi16((short)lineMasks[l]);
+                    __m128i m = _mm_and_si128(me, line), t = _mm_and_si128(them, line);
+                    // exactly two bits: more than one (m & (m - 1) != 0) but not all three
+                    __m128i meTwo = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(m, _mm_add_epi16(m, ones)), zero),
+                                                                  _mm_cmpeq_epi16(m, line)), ones);
+                    __m128i themTwo = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(t, _mm_add_epi16(t, ones)), zero),
+                                                                    _mm_cmpeq_epi16(t, line)), ones);
+                    s = _mm_add_epi16(s, _mm_and_si128(_mm_and_si128(meTwo, _mm_cmpeq_epi16(t, zero)), _mm_set1_epi16(10)));
+                    s = _mm_sub_epi16(s, _mm_and_si128(_mm_and_si128(themTwo, _mm_cmpeq_epi16(m, zero)), _mm_set1_epi16(8)));
+                }
+            }
+        }
+        _mm_storeu_si128((__m128i *)(score + i), s);
+    }
+    return i;
+}
+
+// ---------------- AVX2: 16 boards per register ----------------
+__attribute__((target("avx2"))) static inline __m256i popCount16(__m256i v) {
+    v = _mm256_sub_epi16(v, _mm256_and_si256(_mm256_srli_epi16(v, 1), _mm256_set1_epi16(0x5555)));
+    v = _mm256_add_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0x3333)), _mm256_and_si256(_mm256_srli_epi16(v, 2), _mm256_set1_epi16(0x3333)));
+    v = _mm256_and_si256(_mm256_add_epi16(v, _mm256_srli_epi16(v, 4)), _mm256_set1_epi16(0x0F0F));
+    return _mm256_and_si256(_mm256_add_epi16(v, _mm256_srli_epi16(v, 8)), _mm256_set1_epi16(0x1F));
+}
+
+__attribute__((target("avx2"))) static inline __m256i positional16(__m256i v) {
+    __m256i s = _mm256_slli_epi16(popCount16(v), 1);
+    s = _mm256_add_epi16(s, popCount16(_mm256_and_si256(v, _mm256_set1_epi16(CENTER_MASK | CORNER_MASK))));
+    return _mm256_add_epi16(s, _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi16(1)), 1));
+}
+
+__attribute__((target("avx2")))
+static size_t avx2Range(const BoardBatch *b, size_t n, int difficulty, short *score, unsigned char *status) {
+    const __m256i zero = _mm256_setzero_si256(), ones = _mm256_set1_epi16(-1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(b->x + i));
+        __m256i o = _mm256_loadu_si256((const __m256i *)(b->o + i));
+        __m256i turn = _mm256_sub_epi16(zero, _mm256_loadu_si256((const __m256i *)(b->oToMove + i)));
+        __m256i me = _mm256_blendv_epi8(x, o, turn);
+        __m256i them = _mm256_blendv_epi8(o, x, turn);
+
+        __m256i xWon = zero, oWon = zero;
+        for (int l = 0; l < 8; l++) {
+            __m256i line = _mm256_set1_epi16((short)lineMasks[l]);
+            xWon = _mm256_or_si256(xWon, _mm256_cmpeq_epi16(_mm256_and_si256(x, line), line));
+            oWon = _mm256_or_si256(oWon, _mm256_cmpeq_epi16(_mm256_and_si256(o, line), line));
+        }
+        __m256i full = _mm256_cmpeq_epi16(_mm256_or_si256(x, o), _mm256_set1_epi16(FULL_MASK));
+        __m256i flags = _mm256_or_si256(_mm256_and_si256(xWon, _mm256_set1_epi16(BATCH_X_WON)),
+                        _mm256_or_si256(_mm256_and_si256(oWon, _mm256_set1_epi16(BATCH_O_WON)), _mm256_and_si256(full, _mm256_set1_epi16(BATCH_FULL))));
+        // packus works per 128-bit half: the 16 bytes we want end up in qwords 0 and 2
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(flags, zero), 0x08);
+        _mm_storeu_si128((__m128i *)(status + i), _mm256_castsi256_si128(packed));
+
+        __m256i s;
+        if (difficulty == 3) {
+            __m256i meWon = _mm256_blendv_epi8(xWon, oWon, turn);
+            __m256i themWon = _mm256_andnot_si256(meWon, _mm256_blendv_epi8(oWon, xWon, turn));
+            s = _mm256_sub_epi16(_mm256_and_si256(meWon, _mm256_set1_epi16(10)), _mm256_and_si256(themWon, _mm256_set1_epi16(10)));
+        } else {
+            s = _mm256_sub_epi16(positional16(me), positional16(them));
+            if (difficulty >= 2) {
+                for (int l = 0; l < 8; l++) {
+                    __m256i line = _mm256_set1_epi16((short)lineMasks[l]);
+                    __m256i m = _mm256_and_si256(me, line), t = _mm256_and_si256(them, line);
+                    __m256i meTwo = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi16(_mm256_and_si256(m, _mm256_add_epi16(m, ones)), zero),
+                                                                        _mm256_cmpeq_epi16(m, line)), ones);
+                    __m256i themTwo = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi16(_mm256_and_si256(t, _mm256_add_epi16(t, ones)), zero),
+                                                                          _mm256_cmpeq_epi16(t, line)), ones);
+                    s = _mm256_add_epi16(s, _mm256_and_si256(_mm256_and_si256(meTwo, _mm256_cmpeq_epi16(t, zero)), _mm256_set1_epi16(10)));
+                    s = _mm256_sub_epi16(s, _mm256_and_si256(_mm256_and_si256(themTwo, _mm256_cmpeq_epi16(m, zero)), _mm256_set1_epi16(8)));
+                }
+            }
+        }
+        _mm256_storeu_si256((__m256i *)(score + i), s);
+    }
+    return i;
+}
+#endif
+
+// Best kernel the CPU can run, no higher than the one asked for
+static BatchKernel resolveKernel(BatchKernel wanted) {
+#ifdef BATCH_X86
+    if ((wanted == BATCH_AUTO || wanted == BATCH_AVX2) && __builtin_cpu_supports("avx2")) return BATCH_AVX2;
+    if (wanted != BATCH_SCALAR && __builtin_cpu_supports("sse2")) return BATCH_SSE2;
+#else
+    (void)wanted;
+#endif
+    return BATCH_SCALAR;
+}
+
+BatchKernel batchSetKernel(BatchKernel wanted) {
+    requestedKernel = wanted;
+    return resolveKernel(wanted);
+}
+
+const char *batchKernelName(BatchKernel kernel) {
+    static const char *names[] = { "auto", "scalar", "sse2", "avx2" };
+    return names[kernel];
+}
+
+void evaluateBatch(const BoardBatch *batch, int difficulty, short *score, unsigned char *status) {
+    size_t done = 0;
+#ifdef BATCH_X86
+    switch (resolveKernel(requestedKernel)) {
+    case BATCH_AVX2: done = avx2Range(batch, batch->count, difficulty, score, status); break;
+    case BATCH_SSE2: done = sse2Range(batch, batch->count, difficulty, score, status); break;
+    default: break;
+    }
+#endif
+    scalarRange(batch, done, batch->count, difficulty, score, status); // the tail that doesn't fill a register
+}
+
+// Array-of-structs entry point: transpose a chunk at a time into SoA, evaluate, write the results back
+void evaluateBoards(const Board *boards, size_t n, int difficulty, Result *out) {
+    unsigned short x[CHUNK], o[CHUNK], oToMove[CHUNK];
+    short score[CHUNK];
+    unsigned char status[CHUNK];
+
+    for (size_t base = 0; base < n; base += CHUNK) {
+        size_t count = (n - base < CHUNK) ? n - base : CHUNK;
+        for (size_t i = 0; i < count; i++) {
+            x[i] = boards[base + i].x;
+            o[i] = boards[base + i].o;
+            oToMove[i] = boards[base + i].toMove == 'O';
+        }
+        BoardBatch batch = { x, o, oToMove, count };
+        evaluateBatch(&batch, difficulty, score, status);
+
+        for (size_t i = 0; i < count; i++) {
+            Result *r = &out[base + i];
+            r->winner = (status[i] & BATCH_X_WON) ? 'X' : (status[i] & BATCH_O_WON) ? 'O' : 0;
+            r->terminal = status[i] != 0;
+            r->score = score[i];
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef BATCH_EVAL_H
+#define BATCH_EVAL_H
+
+#include <stddef.h>
+
+// Batch position evaluation for offline labelling: terminal detection and the engine's evaluate() heuristic
+// for many 3x3 boards at once. Boards are processed in structure-of-arrays form, 16 per AVX2 instruction
+// (8 with SSE2), with a scalar fallback on other CPUs.
+
+// Bitboards as in minimax_improved.c: bit (row * 3 + col) is set when that cell holds the mark
+typedef struct {
+    unsigned short x, o;
+    char toMove; // 'X' or 'O'
+} Board;
+
+typedef struct {
+    char winner;            // 'X', 'O' or 0
+    unsigned char terminal; // 1 if someone won or the board is full
+    short score;            // evaluate() at the requested difficulty, for the side to move
+} Result;
+
+// Structure-of-arrays batch, filled by the caller. All arrays hold count entries
+typedef struct {
+    const unsigned short *x, *o;
+    const unsigned short *oToMove; // 1 when O is to move, 0 for X
+    size_t count;
+} BoardBatch;
+
+#define BATCH_X_WON 1
+#define BATCH_O_WON 2
+#define BATCH_FULL 4
+
+typedef enum { BATCH_AUTO, BATCH_SCALAR, BATCH_SSE2, BATCH_AVX2 } BatchKernel;
+
+// difficulty picks the heuristic like evaluate(): 1 positional, 2 positional + two-in-a-row, 3 win/loss only
+void evaluateBoards(const Board *boards, size_t n, int difficulty, Result *out);
+void evaluateBatch(const BoardBatch *batch, int difficulty, short *score, unsigned char *status); // status: BATCH_* bits
+
+BatchKernel batchSetKernel(BatchKernel wanted); // falls back to what the CPU supports, returns the kernel in use
+const char *batchKernelName(BatchKernel kernel);
+
+#endif
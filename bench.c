@@ -0,0 +1,261 @@
+// Headless engine benchmark: runs every engine on every reachable position where the AI ('O') is to move
+// Build and run:  gcc -O2 bench.c minimax.c minimax_improved.c metrics.c batch_eval.c -o bench && ./bench --format csv
+// On Windows also link -lpsapi for the memory readings
+// Search telemetry (nodes and cutoffs per ply, branching factor, evaluate() time) per move: build with
+// -DSEARCH_TELEMETRY and run with --positions --format json. Timings of such a build include the counting
+// --batch N instead times evaluateBoards() on N boards with every kernel the CPU supports
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "minimax.h"
+#include "batch_eval.h"
+
+#define CELLS 9
+#define POSITIONS 19683 // 3^9
+
+typedef struct {
+    const char *name;
+    int difficulty; // 0 = findBestMoveBasic from minimax.c
+} Engine;
+
+static const Engine engines[] = {
+    {"basic", 0},
+    {"improved-easy", 1},
+    {"improved-medium", 2},
+    {"improved-hard", 3},
+};
+#define ENGINE_COUNT (int)(sizeof(engines) / sizeof(engines[0]))
+
+static const int lines[8][3] = {
+    {0,1,2},{3,4,5},{6,7,8}, // rows
+    {0,3,6},{1,4,7},{2,5,8}, // columns
+    {0,4,8},{2,4,6}          // diagonals
+};
+
+static SearchContext ctx; // too big for the stack on some platforms
+static char positions[POSITIONS][CELLS];
+static int positionCount = 0;
+static unsigned char seen[POSITIONS];
+
+static int hasWinner(const char *b) {
+    for (int i = 0; i < 8; i++)
+        if (b[lines[i][0]] != ' ' && b[lines[i][0]] == b[lines[i][1]] && b[lines[i][1]] == b[lines[i][2]])
+            return 1;
+    return 0;
+}
+
+static int indexOf(const char *b) {
+    int idx = 0;
+    for (int i = CELLS - 1; i >= 0; i--)
+        idx = idx * 3 + (b[i] == 'X' ? 1 : b[i] == 'O' ? 2 : 0);
+    return idx;
+}
+
+// Walk every game from b, recording each unfinished position where 'O' moves next
+static void enumerate(char *b, char toMove, int empty) {
+    if (empty == 0 || hasWinner(b)) return;
+    int idx = indexOf(b);
+    if (toMove == 'O') {
+        if (seen[idx]) return;
+        seen[idx] = 1;
+        memcpy(positions[positionCount++], b, CELLS);
+    }
+    for (int i = 0; i < CELLS; i++) {
+        if (b[i] != ' ') continue;
+        b[i] = toMove;
+        enumerate(b, toMove == 'X' ? 'O' : 'X', empty - 1);
+        b[i] = ' ';
+    }
+}
+
+static int compareIndex(const void *a, const void *b) {
+    return indexOf(a) - indexOf(b);
+}
+
+static int compareNs(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *)a, y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of an ascending array
+static unsigned long long percentile(const unsigned long long *sorted, int n, int p) {
+    int rank = (p * n + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+// Boards per second of the batch evaluator, for each kernel the CPU has and each difficulty
+static int benchBatch(long count, MetricsFormat format) {
+    Board *boards = malloc(sizeof(Board) * count);
+    Result *results = malloc(sizeof(Result) * count);
+    if (!boards || !results) {
+        printf("Out of memory\n");
+        free(boards);
+        free(results);
+        return 1;
+    }
+    for (long i = 0; i < count; i++) { // cycle through the reachable positions
+        const char *p = positions[i % positionCount];
+        Board b = { 0, 0, 'O' };
+        for (int c = 0; c < CELLS; c++) {
+            if (p[c] == 'X') b.x |= (unsigned short)(1u << c);
+            if (p[c] == 'O') b.o |= (unsigned short)(1u << c);
+        }
+        boards[i] = b;
+    }
+
+    if (format == METRICS_CSV) printf("kernel,difficulty,boards,total_ns,boards_per_sec\n");
+    for (int k = BATCH_SCALAR; k <= BATCH_AVX2; k++) {
+        if (batchSetKernel((BatchKernel)k) != (BatchKernel)k) continue; // not on this CPU
+        for (int d = 1; d <= 3; d++) {
+            unsigned long long start = metricsNowNs();
+            evaluateBoards(boards, (size_t)count, d, results);
+            unsigned long long ns = metricsNowNs() - start;
+            double rate = ns ? count / (ns / 1e9) : 0.0;
+            const char *name = batchKernelName((BatchKernel)k);
+            if (format == METRICS_CSV)
+                printf("%s,%d,%ld,%llu,%.0f\n", name, d, count, ns, rate);
+            else if (format == METRICS_JSON)
+                printf("{\"kernel\":\"%s\",\"difficulty\":%d,\"boards\":%ld,\"total_ns\":%llu,\"boards_per_sec\":%.0f}\n",
+                       name, d, count, ns, rate);
+            else
+                printf("%-6s difficulty %d: %ld boards in %.3lf s, %.0f boards/s\n", name, d, count, ns / 1e9, rate);
+        }
+    }
+    batchSetKernel(BATCH_AUTO);
+    free(boards);
+    free(results);
+    return 0;
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [--format text|csv|json] [--seed N] [--repeat N] [--positions] [--no-tablebase]\n"
+           "          [--search plain|ordered|pvs] [--batch N]\n", prog);
+    printf("  --positions     also write the stats of every single search\n");
+    printf("  --no-tablebase  make Hard search instead of reading the precomputed table\n");
+    printf("  --search        plain: alpha-beta, root in row-major order; ordered: root ordering; pvs: ordered\n"
+           "                  plus principal variation search (default)\n");
+    printf("  --batch N       time the batch evaluator on N boards instead of the engines\n");
+}
+
+int main(int argc, char **argv) {
+    MetricsFormat format = METRICS_TEXT;
+    unsigned long long seed = 12345;
+    int repeat = 1, perPosition = 0, useTablebase = 1, ordering = 1, pvs = 1;
+    long batchBoards = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "csv") == 0) format = METRICS_CSV;
+            else if (strcmp(argv[i], "json") == 0) format = METRICS_JSON;
+            else if (strcmp(argv[i], "text") == 0) format = METRICS_TEXT;
+            else { usage(argv[0]); return 1; }
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+            if (repeat < 1) repeat = 1;
+        } else if (strcmp(argv[i], "--positions") == 0) {
+            perPosition = 1;
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batchBoards = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--no-tablebase") == 0) {
+            useTablebase = 0;
+        } else if (strcmp(argv[i], "--search") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "plain") == 0) ordering = pvs = 0;
+            else if (strcmp(argv[i], "ordered") == 0) { ordering = 1; pvs = 0; }
+            else if (strcmp(argv[i], "pvs") == 0) ordering = pvs = 1;
+            else { usage(argv[0]); return 1; }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Both starters: X first leaves O moving on odd plies, O first on even ones
+    char b[CELLS];
+    memset(b, ' ', sizeof(b));
+    enumerate(b, 'X', CELLS);
+    enumerate(b, 'O', CELLS);
+    qsort(positions, positionCount, CELLS, compareIndex); // same order on every machine
+    if (batchBoards > 0) return benchBatch(batchBoards, format);
+
+    int samples = positionCount * repeat;
+    unsigned long long *latency = malloc(sizeof(*latency) * samples);
+    if (!latency) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    if (format == METRICS_CSV)
+        printf(perPosition ? "label,elapsed_ns,nodes,max_depth,cutoffs,tt_hits,rss_bytes,peak_rss_bytes\n"
+                           : "engine,positions,searches,total_ns,nodes,nodes_per_sec,p50_ns,p99_ns,max_ns,"
+                             "max_nodes,cutoffs,tt_hits,peak_rss_bytes\n");
+    else if (format == METRICS_TEXT)
+        printf("%d positions, seed %llu, %d repeat(s)\n\n", positionCount, seed, repeat);
+
+    for (int e = 0; e < ENGINE_COUNT; e++) {
+        const Engine *engine = &engines[e];
+        unsigned long long totalNs = 0;
+        long totalNodes = 0, maxNodes = 0, cutoffs = 0, ttHits = 0;
+        size_t peakRss = 0;
+        searchContextInit(&ctx, 'O', engine->difficulty, seed); // same seed, same moves
+        ctx.useTablebase = useTablebase;
+        ctx.ordering = ordering;
+        ctx.pvs = pvs;
+        int n = 0;
+
+        for (int r = 0; r < repeat; r++) {
+            for (int p = 0; p < positionCount; p++) {
+                char board[SIZE][SIZE];
+                memcpy(board, positions[p], CELLS);
+                searchContextNewGame(&ctx); // every search starts cold, so counts don't depend on the order
+                Move move = engine->difficulty == 0 ? findBestMoveBasic(&ctx, board) : findBestMove(&ctx, board);
+                const SearchStats stats = ctx.stats;
+
+                latency[n++] = stats.elapsedNs;
+                totalNs += stats.elapsedNs;
+                totalNodes += stats.nodes;
+                cutoffs += stats.cutoffs;
+                ttHits += stats.ttHits;
+                if (stats.nodes > maxNodes) maxNodes = stats.nodes;
+                if (stats.peakRssBytes > peakRss) peakRss = stats.peakRssBytes;
+
+                if (perPosition && r == 0) {
+                    char label[64];
+                    snprintf(label, sizeof(label), "%s:%.9s:%d", engine->name, positions[p], move.row * SIZE + move.col);
+                    for (char *c = label; *c; c++) if (*c == ' ') *c = '_';
+                    metricsWrite(stdout, format, label, &stats);
+                }
+            }
+        }
+
+        qsort(latency, n, sizeof(*latency), compareNs);
+        double nps = totalNs ? totalNodes / (totalNs / 1e9) : 0.0;
+        unsigned long long p50 = percentile(latency, n, 50), p99 = percentile(latency, n, 99), worst = latency[n - 1];
+
+        if (perPosition && format != METRICS_TEXT) continue; // keep the machine-readable output one row type
+        switch (format) {
+        case METRICS_CSV:
+            printf("%s,%d,%d,%llu,%ld,%.0f,%llu,%llu,%llu,%ld,%ld,%ld,%zu\n", engine->name, positionCount, n, totalNs,
+                   totalNodes, nps, p50, p99, worst, maxNodes, cutoffs, ttHits, peakRss);
+            break;
+        case METRICS_JSON:
+            printf("{\"engine\":\"%s\",\"positions\":%d,\"searches\":%d,\"total_ns\":%llu,\"nodes\":%ld,"
+                   "\"nodes_per_sec\":%.0f,\"p50_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu,\"max_nodes\":%ld,"
+                   "\"cutoffs\":%ld,\"tt_hits\":%ld,\"peak_rss_bytes\":%zu}\n", engine->name, positionCount, n, totalNs,
+                   totalNodes, nps, p50, p99, worst, maxNodes, cutoffs, ttHits, peakRss);
+            break;
+        default:
+            printf("%s\n  searches: %d, total %.3lf s\n  nodes: %ld (max %ld per move), %.0f nodes/s\n"
+                   "  latency: p50 %.1lf us, p99 %.1lf us, max %.1lf us\n  cutoffs: %ld, TT hits: %ld\n"
+                   "  peak memory: %zu KB\n\n", engine->name, n, totalNs / 1e9, totalNodes, maxNodes, nps,
+                   p50 / 1e3, p99 / 1e3, worst / 1e3, cutoffs, ttHits, peakRss / 1024);
+            break;
+        }
+    }
+
+    free(latency);
+    return 0;
+}
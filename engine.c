@@ -0,0 +1,259 @@
+// Headless engine: a long-lived process driven by a line protocol on stdin/stdout, loosely like UCI.
+// Build:  gcc -O2 engine.c minimax.c minimax_improved.c mnk.c mcts.c naive_bayes.c threadpool.c metrics.c -lpthread -lm -o engine
+//
+// Commands (one per line, answers go to stdout; commands can be pipelined, they are handled in order):
+//   uci                          -> id name ..., uciok
+//   isready                      -> readyok (once every earlier command has been answered)
+//   engine auto|minimax|basic|nb|mnk|mcts
+//                                auto = minimax on 3x3, mnk on anything else (like the game)
+//                                mcts plays any board; go nodes <n> is its playout budget
+//   difficulty 1|2|3
+//   board <width> <height> <k>   board size and line length, 3 3 3 by default. Also clears the position
+//   position <cells> [turn x|o]  cells row-major, X, O and '.' or '-' for empty. Without turn: X moves
+//                                when both sides have as many marks, otherwise O. Rejected (the previous
+//                                position stays) if the mark counts don't fit the side to move or a line is won
+//   position startpos [turn x|o]
+//   newgame                      forget the previous game's positions (transposition table, search trees)
+//   seed <n>                     seed for random choices
+//   threads 0|1                  mnk search on every core (1, default) or on this thread
+//   go [nodes <n>] [movetime <ms>] [depth <n>]
+//                                -> info ... then bestmove <row> <col> (bestmove none if the board is full)
+//                                nodes and movetime apply to minimax, mnk and mcts, depth to mnk; without them
+//                                minimax keeps to its difficulty's budget (see minimax.h)
+//   stats [text|csv|json]        -> last search and session totals
+//   quit
+// Problems are reported as "info string error: ..." and never end the process.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "mnk.h"
+#include "mcts.h"
+#include "naive_bayes.h"
+#include "threadpool.h"
+
+typedef enum { ENGINE_AUTO, ENGINE_MINIMAX, ENGINE_BASIC, ENGINE_NB, ENGINE_MNK, ENGINE_MCTS } EngineKind;
+static const char *engineNames[] = { "auto", "minimax", "basic", "nb", "mnk", "mcts" };
+#define ENGINE_KINDS (int)(sizeof(engineNames) / sizeof(engineNames[0]))
+
+static MnkRules rules;
+static char board[MNK_MAX_CELLS];
+static char toMove = 'X';
+static EngineKind engine = ENGINE_AUTO;
+static int difficulty = 3;
+static MnkOptions options = { 1, 12345, NULL, 0, 0, 0 };
+static const NaiveBayesModel *nbModel = NULL;
+static SearchContext search; // 3x3 engines: seed and transposition table carry over between go commands
+static MctsContext mcts;     // search trees, kept between the go commands of a game
+
+static SearchStats lastStats;
+static const char *lastEngine = "none";
+static long searches = 0, totalNodes = 0;
+static unsigned long long totalNs = 0;
+
+static void error(const char *message, const char *detail) {
+    printf("info string error: %s%s%s\n", message, detail ? " " : "", detail ? detail : "");
+}
+
+static int isClassic(void) {
+    return rules.width == SIZE && rules.height == SIZE && rules.k == SIZE;
+}
+
+// The model is only needed once someone asks for the nb engine
+static int loadNaiveBayes(void) {
+    if (nbModel) return 1;
+    nbModel = nbMapModel(getenv("TTT_NB_MODEL") ? getenv("TTT_NB_MODEL") : "tic-tac-toe.nbm");
+    if (!nbModel) {
+        static NaiveBayesModel trained;
+        if (!nbTrain(&trained, "tic-tac-toe.data")) return 0;
+        nbModel = &trained;
+    }
+    return 1;
+}
+
+static void setPosition(char *args) {
+    char *cells = strtok(args, " \t");
+    if (!cells) { error("position needs cells or startpos", NULL); return; }
+
+    char next[MNK_MAX_CELLS];
+    int xs = 0, os = 0;
+    if (strcmp(cells, "startpos") == 0) {
+        memset(next, ' ', sizeof(next));
+    } else {
+        if ((int)strlen(cells) != rules.cells) { error("position needs width * height cells, got", cells); return; }
+        memset(next, ' ', sizeof(next));
+        for (int i = 0; i < rules.cells; i++) {
+            char c = (char)toupper((unsigned char)cells[i]);
+            if (c == 'X' || c == 'O') next[i] = c;
+            else if (c != '.' && c != '-') { error("bad cell in", cells); return; }
+            xs += (c == 'X');
+            os += (c == 'O');
+        }
+    }
+
+    char turn = (xs > os) ? 'O' : 'X';
+    char *word = strtok(NULL, " \t");
+    if (word && strcmp(word, "turn") == 0) {
+        char *side = strtok(NULL, " \t");
+        if (!side || (tolower((unsigned char)side[0]) != 'x' && tolower((unsigned char)side[0]) != 'o')) {
+            error("turn needs x or o", NULL);
+            return;
+        }
+        turn = (char)toupper((unsigned char)side[0]);
+    } else if (word) {
+        error("unexpected", word);
+        return;
+    }
+
+    // Marks alternate whoever opened, so the side to move has as many marks as the other side or one fewer
+    int behind = (turn == 'X') ? os - xs : xs - os;
+    if (behind < 0 || behind > 1) { error("mark counts don't fit the side to move:", cells); return; }
+    if (mnkWinner(&rules, next)) { error("game is already decided:", cells); return; }
+    memcpy(board, next, sizeof(board));
+    toMove = turn;
+}
+
+// Search for the side to move. The mnk, mcts and nb engines play 'O', so for X they search with the marks swapped
+static void go(char *args) {
+    MnkOptions limits = options;
+    for (char *word = strtok(args, " \t"); word; word = strtok(NULL, " \t")) {
+        char *value = strtok(NULL, " \t");
+        if (!value) { error("missing value for", word); return; }
+        if (strcmp(word, "nodes") == 0) limits.nodeLimit = atol(value);
+        else if (strcmp(word, "movetime") == 0) limits.timeLimitMs = strtoul(value, NULL, 10);
+        else if (strcmp(word, "depth") == 0) limits.maxDepth = atoi(value);
+        else { error("unknown go limit", word); return; }
+    }
+
+    if (mnkWinner(&rules, board) || !memchr(board, ' ', rules.cells)) {
+        printf("bestmove none\n");
+        return;
+    }
+
+    EngineKind kind = engine;
+    if (kind == ENGINE_AUTO) kind = isClassic() ? ENGINE_MINIMAX : ENGINE_MNK;
+    if (kind != ENGINE_MNK && kind != ENGINE_MCTS && !isClassic()) { error("engine only plays 3x3:", engineNames[kind]); return; }
+    if (kind == ENGINE_NB && !loadNaiveBayes()) { error("no Naive Bayes model", NULL); return; }
+    if (kind == ENGINE_MCTS && !mcts.treeCount && !mctsInit(&mcts, 1)) { error("out of memory for mcts", NULL); return; }
+
+    char view[MNK_MAX_CELLS];
+    for (int i = 0; i < rules.cells; i++)
+        view[i] = (toMove == 'O' || board[i] == ' ') ? board[i] : (board[i] == 'X' ? 'O' : 'X');
+
+    SearchStats stats = {0};
+    Move move;
+    switch (kind) {
+    case ENGINE_MNK:
+        move = mnkFindBestMove(&rules, view, difficulty, &limits, &stats);
+        options.seed++; // next search breaks ties differently, like the game does
+        break;
+    case ENGINE_MCTS:
+        move = mctsFindBestMove(&mcts, &rules, view, difficulty, &limits, &stats);
+        options.seed++;
+        break;
+    case ENGINE_BASIC:
+        search.player = toMove;
+        search.opponent = (toMove == 'X') ? 'O' : 'X';
+        move = findBestMoveBasic(&search, (char (*)[SIZE])board);
+        stats = search.stats;
+        break;
+    case ENGINE_NB: {
+        unsigned long long start = metricsNowNs();
+        move = nbFindBestMove(nbModel, (char (*)[SIZE])view);
+        metricsFinish(&stats, start);
+        break;
+    }
+    default:
+        search.player = toMove;
+        search.opponent = (toMove == 'X') ? 'O' : 'X';
+        search.difficulty = difficulty;
+        search.nodeLimit = limits.nodeLimit;
+        search.timeLimitMs = limits.timeLimitMs;
+        move = findBestMove(&search, (char (*)[SIZE])board);
+        stats = search.stats;
+        break;
+    }
+
+    lastStats = stats;
+    lastEngine = engineNames[kind];
+    searches++;
+    totalNodes += stats.nodes;
+    totalNs += stats.elapsedNs;
+    printf("info engine %s depth %d nodes %ld cutoffs %ld tthits %ld time_ns %llu\n", lastEngine, stats.maxDepth,
+           stats.nodes, stats.cutoffs, stats.ttHits, stats.elapsedNs);
+    printf("bestmove %d %d\n", move.row, move.col);
+}
+
+static void report(const char *format) {
+    MetricsFormat f = METRICS_TEXT;
+    if (format && strcmp(format, "csv") == 0) f = METRICS_CSV;
+    else if (format && strcmp(format, "json") == 0) f = METRICS_JSON;
+    else if (format && strcmp(format, "text") != 0) { error("unknown stats format", format); return; }
+
+    if (f == METRICS_CSV) printf("label,elapsed_ns,nodes,max_depth,cutoffs,tt_hits,rss_bytes,peak_rss_bytes\n");
+    metricsWrite(stdout, f, lastEngine, &lastStats);
+    printf("info searches %ld nodes %ld time_ns %llu nps %.0f\n", searches, totalNodes, totalNs,
+           totalNs ? totalNodes / (totalNs / 1e9) : 0.0);
+}
+
+int main(void) {
+    char line[1024], none[] = "";
+    mnkInitRules(&rules, 3, 3, 3);
+    memset(board, ' ', sizeof(board));
+    searchContextInit(&search, 'O', difficulty, options.seed);
+
+    while (fgets(line, sizeof(line), stdin)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char *command = strtok(line, " \t");
+        char *rest = strtok(NULL, ""); // everything after the command
+        if (!command) continue;
+
+        if (strcmp(command, "uci") == 0) {
+            printf("id name TicTacToe engine\nuciok\n");
+        } else if (strcmp(command, "isready") == 0) {
+            printf("readyok\n");
+        } else if (strcmp(command, "engine") == 0) {
+            int kind = -1;
+            for (int i = 0; rest && i < ENGINE_KINDS; i++)
+                if (strcmp(rest, engineNames[i]) == 0) kind = i;
+            if (kind < 0) error("unknown engine", rest);
+            else engine = kind;
+        } else if (strcmp(command, "difficulty") == 0) {
+            int level = rest ? atoi(rest) : 0;
+            if (level < 1 || level > 3) error("difficulty must be 1, 2 or 3", NULL);
+            else difficulty = level;
+        } else if (strcmp(command, "board") == 0) {
+            int w = 0, h = 0, k = 0;
+            if (!rest || sscanf(rest, "%d %d %d", &w, &h, &k) != 3 || w < 1 || h < 1 || w > MNK_MAX_DIM ||
+                h > MNK_MAX_DIM || k < 1 || (k > w && k > h)) {
+                error("board needs width height k, at most 8x8", NULL);
+            } else {
+                mnkInitRules(&rules, w, h, k);
+                memset(board, ' ', sizeof(board));
+                toMove = 'X';
+            }
+        } else if (strcmp(command, "position") == 0) {
+            setPosition(rest ? rest : none);
+        } else if (strcmp(command, "newgame") == 0) {
+            searchContextNewGame(&search);
+            mctsNewGame(&mcts);
+        } else if (strcmp(command, "seed") == 0 && rest) {
+            options.seed = strtoull(rest, NULL, 10);
+            rngSeed(&search.rng, options.seed);
+        } else if (strcmp(command, "threads") == 0 && rest) {
+            options.parallel = atoi(rest) != 0;
+        } else if (strcmp(command, "go") == 0) {
+            go(rest ? rest : none);
+        } else if (strcmp(command, "stats") == 0) {
+            report(rest);
+        } else if (strcmp(command, "quit") == 0) {
+            break;
+        } else {
+            error("unknown command", command);
+        }
+        fflush(stdout); // answer now even when stdout is a pipe
+    }
+    mctsFree(&mcts);
+    poolShutdown();
+    return 0;
+}
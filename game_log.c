@@ -0,0 +1,206 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "game_log.h"
+
+#define WORD_MOVES_MASK 0x7FFFFu
+#define WORD_COUNT_SHIFT 19
+#define WORD_DIFFICULTY_SHIFT 23
+#define WORD_MODE_SHIFT 25
+#define WORD_O_FIRST (1u << 27)
+#define WORD_LARGE (1u << 28)
+#define WORD_UNUSED 0xE0000000u
+#define WORD_LARGE_UNUSED 0x007F0000u // bits 16-22 of a larger board's word
+#define LEHMER_LIMIT 362880u // 9!
+
+#define GAME_LOG_BUFFER (64 * 1024) // per buffer, about 16000 3x3 games
+
+static void putWord(unsigned char *out, uint32_t word) {
+    for (int i = 0; i < 4; i++) out[i] = (unsigned char)(word >> (8 * i));
+}
+
+static uint32_t getWord(const unsigned char *in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+static int isClassic(const GameRecord *game) {
+    return game->width == 3 && game->height == 3 && game->k == 3;
+}
+
+int gameLogEncode(const GameRecord *game, unsigned char *out) {
+    uint32_t word = (uint32_t)(game->difficulty & 3) << WORD_DIFFICULTY_SHIFT |
+                    (uint32_t)(game->mode & 3) << WORD_MODE_SHIFT | (game->firstMark == 'O' ? WORD_O_FIRST : 0);
+    if (isClassic(game)) {
+        // Each move becomes its rank among the cells still empty; the ranks are digits of falling bases
+        uint32_t code = 0, base = 1;
+        unsigned short empty = 0x1FF;
+        for (int i = 0; i < game->moveCount; i++) {
+            int cell = game->moves[i];
+            uint32_t rank = 0;
+            for (int c = 0; c < cell; c++) rank += (empty >> c) & 1;
+            code += rank * base;
+            base *= (uint32_t)(9 - i);
+            empty &= (unsigned short)~(1u << cell);
+        }
+        putWord(out, word | code | (uint32_t)game->moveCount << WORD_COUNT_SHIFT);
+        return 4;
+    }
+    word |= WORD_LARGE | (uint32_t)(game->width - 1) | (uint32_t)(game->height - 1) << 3 |
+            (uint32_t)(game->k - 1) << 6 | (uint32_t)game->moveCount << 9;
+    putWord(out, word);
+    memcpy(out + 4, game->moves, game->moveCount);
+    return 4 + game->moveCount;
+}
+
+int gameLogDecode(const unsigned char *in, size_t avail, GameRecord *game) {
+    if (avail < 4) return 0;
+    uint32_t word = getWord(in);
+    if (word & WORD_UNUSED) return -1;
+    game->difficulty = (unsigned char)((word >> WORD_DIFFICULTY_SHIFT) & 3);
+    game->mode = (unsigned char)((word >> WORD_MODE_SHIFT) & 3);
+    game->firstMark = (word & WORD_O_FIRST) ? 'O' : 'X';
+
+    if (!(word & WORD_LARGE)) {
+        uint32_t code = word & WORD_MOVES_MASK;
+        int count = (int)((word >> WORD_COUNT_SHIFT) & 0xF);
+        if (count > 9 || code >= LEHMER_LIMIT) return -1;
+        game->width = game->height = game->k = 3;
+        game->moveCount = (unsigned char)count;
+        unsigned short empty = 0x1FF;
+        for (int i = 0; i < count; i++) {
+            uint32_t rank = code % (uint32_t)(9 - i);
+            code /= (uint32_t)(9 - i);
+            int cell = 0;
+            for (;; cell++) // the rank-th empty cell
+                if (((empty >> cell) & 1) && rank-- == 0) break;
+            game->moves[i] = (unsigned char)cell;
+            empty &= (unsigned short)~(1u << cell);
+        }
+        return code == 0 ? 4 : -1; // digits left over: more moves than the count says
+    }
+
+    game->width = (unsigned char)((word & 7) + 1);
+    game->height = (unsigned char)(((word >> 3) & 7) + 1);
+    game->k = (unsigned char)(((word >> 6) & 7) + 1);
+    int count = (int)((word >> 9) & 0x7F), cells = game->width * game->height;
+    if ((word & WORD_LARGE_UNUSED) || count > cells ||
+        game->k > (game->width > game->height ? game->width : game->height))
+        return -1;
+    if (avail < 4 + (size_t)count) return 0;
+    uint64_t seen = 0;
+    for (int i = 0; i < count; i++) {
+        int cell = in[4 + i];
+        if (cell >= cells || ((seen >> cell) & 1)) return -1;
+        seen |= 1ull << cell;
+        game->moves[i] = (unsigned char)cell;
+    }
+    game->moveCount = (unsigned char)count;
+    return 4 + count;
+}
+
+int gameLogRecordSize(const unsigned char *in, size_t avail) {
+    if (avail < 4) return 0;
+    uint32_t word = getWord(in);
+    int count = (int)((word >> 9) & 0x7F);
+    // A word claiming more moves than a board has is damage: skip just the word and carry on after it
+    int size = (word & WORD_LARGE) && count <= GAME_LOG_MAX_MOVES ? 4 + count : 4;
+    return (size_t)size <= avail ? size : 0;
+}
+
+// Writer state, guarded by lock. The game fills buffers[active]; the thread swaps it for the other one and
+// writes that out with the lock released
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static pthread_t writer;
+static FILE *logFile = NULL;
+static int closing = 0;
+static unsigned char buffers[2][GAME_LOG_BUFFER];
+static int active = 0;
+static size_t filled = 0;
+static unsigned long dropped = 0;
+
+static void *writerMain(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (!filled && !closing) pthread_cond_wait(&wake, &lock);
+        if (!filled) break; // closing and nothing left
+        const unsigned char *out = buffers[active];
+        size_t size = filled;
+        active ^= 1;
+        filled = 0;
+        pthread_mutex_unlock(&lock);
+        if (fwrite(out, 1, size, logFile) != size || fflush(logFile) != 0) printf("Unable to write the game log\n");
+        pthread_mutex_lock(&lock);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+int gameLogOpen(const char *path) {
+    if (logFile) return 1;
+    unsigned char header[GAME_LOG_HEADER_BYTES] = { 0 };
+    memcpy(header, GAME_LOG_MAGIC, 4);
+    header[4] = GAME_LOG_VERSION;
+
+    // Only ever append to a log of this version: records of another layout would be misread
+    FILE *existing = fopen(path, "rb");
+    if (existing) {
+        unsigned char found[GAME_LOG_HEADER_BYTES];
+        size_t got = fread(found, 1, sizeof(found), existing);
+        fclose(existing);
+        if (got != 0 && (got != sizeof(found) || memcmp(found, header, sizeof(header)) != 0)) {
+            printf("%s is not a version %d game log, games are not logged\n", path, GAME_LOG_VERSION);
+            return 0;
+        }
+    }
+    FILE *fp = fopen(path, "ab");
+    if (!fp) {
+        printf("Unable to open the game log %s\n", path);
+        return 0;
+    }
+    if (fseek(fp, 0, SEEK_END) != 0 || (ftell(fp) == 0 && fwrite(header, sizeof(header), 1, fp) != 1) ||
+        fflush(fp) != 0) {
+        printf("Unable to write the game log %s\n", path);
+        fclose(fp);
+        return 0;
+    }
+    logFile = fp;
+    closing = 0;
+    active = 0;
+    filled = 0;
+    dropped = 0;
+    if (pthread_create(&writer, NULL, writerMain, NULL) != 0) {
+        fclose(fp);
+        logFile = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+void gameLogAppend(const GameRecord *game) {
+    if (!logFile) return;
+    unsigned char record[GAME_LOG_MAX_RECORD];
+    int size = gameLogEncode(game, record);
+    pthread_mutex_lock(&lock);
+    if (filled + (size_t)size > GAME_LOG_BUFFER) {
+        dropped++;
+    } else {
+        memcpy(buffers[active] + filled, record, (size_t)size);
+        filled += (size_t)size;
+        pthread_cond_signal(&wake);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+void gameLogClose(void) {
+    if (!logFile) return;
+    pthread_mutex_lock(&lock);
+    closing = 1;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    pthread_join(writer, NULL);
+    if (fclose(logFile) != 0) printf("Unable to write the game log\n");
+    logFile = NULL;
+    if (dropped) printf("Game log: %lu games dropped, the disk could not keep up\n", dropped);
+}
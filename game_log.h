@@ -0,0 +1,48 @@
+#ifndef GAME_LOG_H
+#define GAME_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Game log: every finished game, appended to one binary file. analyze_log.c reads it back.
+// File: an 8-byte header (GAME_LOG_MAGIC, version byte, 3 zero bytes), then one record per game.
+// A record starts with a little-endian 32-bit word:
+//   bits  0-18  3x3: the moves as a Lehmer code, each the index of its cell among the cells still empty,
+//               read as a mixed-radix number (first move base 9, then 8, ...). Below 9! = 362880
+//   bits 19-22  3x3: number of moves
+//   bits 23-24  difficulty, 0 if none (two players, Naive Bayes)
+//   bits 25-26  mode, GameMode of tic_tac_toe.c: 0 two players, 1 minimax, 2 Naive Bayes, 3 MCTS
+//   bit  27     O moved first
+//   bit  28     larger board: bits 0-15 hold width-1, height-1, k-1 (3 bits each) and the number of moves
+//               (7 bits), and one byte per move follows with its cell, row * width + col
+// So a 3x3 game takes 4 bytes. The marks alternate, so the moves alone give the final position and result
+#define GAME_LOG_MAGIC "TTGL"
+#define GAME_LOG_VERSION 1
+#define GAME_LOG_HEADER_BYTES 8
+#define GAME_LOG_MAX_DIM 8
+#define GAME_LOG_MAX_MOVES (GAME_LOG_MAX_DIM * GAME_LOG_MAX_DIM)
+#define GAME_LOG_MAX_RECORD (4 + GAME_LOG_MAX_MOVES)
+
+typedef struct {
+    unsigned char mode, difficulty;
+    char firstMark;                           // 'X' or 'O'
+    unsigned char width, height, k;
+    unsigned char moveCount;
+    unsigned char moves[GAME_LOG_MAX_MOVES]; // cells in the order they were played
+} GameRecord;
+
+int gameLogEncode(const GameRecord *game, unsigned char *out); // bytes written, at most GAME_LOG_MAX_RECORD
+// Bytes the record at in takes, 0 if it runs past avail, -1 if it is not a valid record
+int gameLogDecode(const unsigned char *in, size_t avail, GameRecord *game);
+// Same size from the first word alone, without decoding the rest: for splitting a log into chunks. Never more
+// than GAME_LOG_MAX_RECORD; a damaged word counts as 4 bytes so reading resumes right after it
+int gameLogRecordSize(const unsigned char *in, size_t avail);
+
+// Streaming writer. Appending only copies the record into a buffer that a background thread writes out,
+// so the game loop never waits on the disk. If the disk falls so far behind that the buffer fills up,
+// records are dropped (and counted) rather than blocking
+int gameLogOpen(const char *path); // appends to path, creating it if needed. 0 if it can't be written
+void gameLogAppend(const GameRecord *game); // no-op if the log isn't open
+void gameLogClose(void); // writes out what is buffered and stops the thread
+
+#endif
@@ -0,0 +1,119 @@
+// Tablebase generator: solves every reachable tic-tac-toe position once and writes tablebase.h
+// Build and run:  gcc gen_tablebase.c -o gen_tablebase && ./gen_tablebase > tablebase.h
+#include <stdio.h>
+#include <string.h>
+
+#define CELLS 9
+#define POSITIONS 19683 // 3^9, index = sum(state[i] * 3^i) with 0 = empty, 1 = X, 2 = O
+
+// Entry layout (16 bits): [14:13] value for the side to move, [12:9] plies to the end, [8:0] optimal moves
+#define TB_UNSOLVED 0
+#define TB_LOSS 1
+#define TB_DRAW 2
+#define TB_WIN 3
+
+static const int lines[8][3] = {
+    {0,1,2},{3,4,5},{6,7,8}, // rows
+    {0,3,6},{1,4,7},{2,5,8}, // columns
+    {0,4,8},{2,4,6}          // diagonals
+};
+
+static unsigned short table[2][POSITIONS]; // [side to move: 0 = X, 1 = O][position]
+static int pow3[CELLS];
+static int solvedCount = 0;
+
+static int hasLine(const char *b, char symbol) {
+    for (int i = 0; i < 8; i++)
+        if (b[lines[i][0]] == symbol && b[lines[i][1]] == symbol && b[lines[i][2]] == symbol)
+            return 1;
+    return 0;
+}
+
+static int indexOf(const char *b) {
+    int idx = 0;
+    for (int i = 0; i < CELLS; i++)
+        idx += (b[i] == 'X' ? 1 : b[i] == 'O' ? 2 : 0) * pow3[i];
+    return idx;
+}
+
+static unsigned short pack(int value, int dist, int moves) {
+    return (unsigned short)((value << 13) | (dist << 9) | moves);
+}
+
+// Exhaustive negamax with memoisation. Returns the packed entry for the side to move
+static unsigned short solve(char *b, int side) {
+    int idx = indexOf(b);
+    if (table[side][idx] != TB_UNSOLVED) return table[side][idx];
+
+    char me = side ? 'O' : 'X', them = side ? 'X' : 'O';
+    unsigned short entry;
+    int empty = 0;
+    for (int i = 0; i < CELLS; i++) empty += (b[i] == ' ');
+
+    if (hasLine(b, them)) {
+        entry = pack(TB_LOSS, 0, 0); // previous move won
+    } else if (empty == 0) {
+        entry = pack(TB_DRAW, 0, 0);
+    } else {
+        int bestValue = 0, bestDist = 0, moves = 0;
+        for (int i = 0; i < CELLS; i++) {
+            if (b[i] != ' ') continue;
+            b[i] = me;
+            unsigned short child = solve(b, !side);
+            b[i] = ' ';
+
+            // Child value is for the opponent, so flip it. Distance grows by the move just played
+            int childValue = child >> 13;
+            int value = (childValue == TB_WIN) ? TB_LOSS : (childValue == TB_LOSS) ? TB_WIN : TB_DRAW;
+            int dist = ((child >> 9) & 0xF) + 1;
+
+            // Better value wins. Among equal values: fastest win, slowest loss, longest draw
+            int better = value > bestValue ||
+                         (value == bestValue && value == TB_WIN && dist < bestDist) ||
+                         (value == bestValue && value != TB_WIN && dist > bestDist);
+            int equal = value == bestValue && (value == TB_DRAW || dist == bestDist);
+            if (better) {
+                if (!(value == TB_DRAW && bestValue == TB_DRAW)) moves = 0; // draws keep every drawing move
+                bestValue = value;
+                bestDist = dist;
+                moves |= 1 << i;
+            } else if (equal) {
+                moves |= 1 << i;
+            }
+        }
+        entry = pack(bestValue, bestDist, moves);
+    }
+    table[side][idx] = entry;
+    solvedCount++;
+    return entry;
+}
+
+int main(void) {
+    pow3[0] = 1;
+    for (int i = 1; i < CELLS; i++) pow3[i] = pow3[i - 1] * 3;
+
+    // Either side can open: the GUI lets the AI (O) start
+    char board[CELLS];
+    memset(board, ' ', sizeof(board));
+    solve(board, 0);
+    solve(board, 1);
+
+    printf("// Generated by gen_tablebase.c - do not edit.\n");
+    printf("// Perfect-play value of every reachable position (%d entries solved), indexed by\n", solvedCount);
+    printf("// [side to move: 0 = X, 1 = O][sum(cell * 3^i), cell 0 = empty, 1 = X, 2 = O, i = row * 3 + col]\n");
+    printf("#ifndef TABLEBASE_H\n#define TABLEBASE_H\n\n");
+    printf("#define TB_UNSOLVED %d\n#define TB_LOSS %d\n#define TB_DRAW %d\n#define TB_WIN %d\n\n",
+           TB_UNSOLVED, TB_LOSS, TB_DRAW, TB_WIN);
+    printf("#define TB_VALUE(e) ((e) >> 13)       // value for the side to move, TB_UNSOLVED if unreachable\n");
+    printf("#define TB_DIST(e)  (((e) >> 9) & 0xF) // plies to the end of the game under perfect play\n");
+    printf("#define TB_MOVES(e) ((e) & 0x1FF)      // bit (row * 3 + col) set for every optimal move\n\n");
+    printf("static const unsigned short tablebase[2][%d] = {\n", POSITIONS);
+    for (int s = 0; s < 2; s++) {
+        printf("{\n");
+        for (int i = 0; i < POSITIONS; i++)
+            printf("%u%s", table[s][i], (i + 1) % 24 == 0 ? ",\n" : ",");
+        printf("\n}%s\n", s == 0 ? "," : "");
+    }
+    printf("};\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,338 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include "mcts.h"
+#include "rng.h"
+#include "threadpool.h"
+
+#define MCTS_X 0
+#define MCTS_O 1
+#define MCTS_DRAW 2
+#define EXPLORATION 1.41f       // UCT exploration constant, about sqrt(2)
+#define LIMIT_CHECK_PLAYOUTS 64 // each tree looks at the clock and the stop flag this often
+#define HIGH_WATER_DIVISOR 2    // a kept subtree is compacted once the arena is more than 1/2 full
+
+struct MctsNode {
+    MctsNode *child, *sibling; // first child, next sibling
+    MnkBits untried;           // moves that have no child yet
+    int visits;
+    float wins;                // for the side that moved into this node: 1 per won playout, 0.5 per draw
+    signed char move;          // cell played to get here, -1 at a fresh root
+    signed char result;        // MCTS_X or MCTS_O won, MCTS_DRAW, -1 while the game goes on
+};
+
+// Shared by the trees of one search: when to give up early
+typedef struct {
+    atomic_int *stop;              // caller's cancel flag, may be NULL
+    unsigned long long deadlineNs; // metricsNowNs() value, 0 = none
+} MctsLimits;
+
+// One tree's share of a search
+typedef struct {
+    MctsTree *tree;
+    const MnkRules *rules;
+    const MctsLimits *limits;
+    long budget; // playouts, -1 = until a limit
+    Rng rng;
+    long playouts;
+    long truncated; // playouts that could not add a node: the arena was full
+    int maxDepth;
+} TreeJob;
+
+static inline int popCount(MnkBits m) { return __builtin_popcountll(m); }
+static inline int lowestBit(MnkBits m) { return __builtin_ctzll(m); }
+
+// Bump allocation: nodes are never freed one by one, the whole arena starts over with the next game
+static void *arenaAlloc(MctsArena *a, size_t bytes) {
+    bytes = (bytes + 15) & ~(size_t)15;
+    if (a->size - a->used < bytes) return NULL;
+    void *p = a->base + a->used;
+    a->used += bytes;
+    return p;
+}
+
+static int completesLine(const MnkRules *r, MnkBits mine, int cell) {
+    for (int i = 0; i < r->cellLineCount[cell]; i++) {
+        MnkBits line = r->lines[r->cellLines[cell][i]];
+        if ((mine & line) == line) return 1;
+    }
+    return 0;
+}
+
+// Node for the position bits, reached by move (-1 for a root). NULL once the arena is full
+static MctsNode *newNode(MctsArena *a, const MnkRules *r, const MnkBits bits[2], int move, int result) {
+    MctsNode *node = arenaAlloc(a, sizeof(MctsNode));
+    if (!node) return NULL;
+    memset(node, 0, sizeof(*node));
+    node->move = (signed char)move;
+    node->result = (signed char)result;
+    if (result < 0) {
+        MnkBits empty = ~(bits[MCTS_X] | bits[MCTS_O]) & r->fullMask;
+        node->untried = mnkCandidateMoves(r, bits);
+        if (!node->untried) node->untried = empty; // nothing next to a mark is free: any empty cell
+        if (!empty) node->result = MCTS_DRAW;
+    }
+    return node;
+}
+
+// UCT: the child with the best average result plus a bonus for being visited rarely
+static MctsNode *selectChild(const MctsNode *node) {
+    float logVisits = logf((float)node->visits);
+    MctsNode *best = node->child;
+    float bestValue = -1.0f;
+    for (MctsNode *c = node->child; c; c = c->sibling) {
+        float value = c->wins / c->visits + EXPLORATION * sqrtf(logVisits / c->visits);
+        if (value > bestValue) {
+            bestValue = value;
+            best = c;
+        }
+    }
+    return best;
+}
+
+// Add a child for one untried move, picked at random; side moves. NULL if the arena is full
+static MctsNode *expand(MctsTree *t, const MnkRules *r, MctsNode *node, const MnkBits bits[2], int side, Rng *rng) {
+    MnkBits m = node->untried;
+    for (int n = rngRange(rng, popCount(m)); n > 0; n--) m &= m - 1;
+    int cell = lowestBit(m);
+
+    MnkBits next[2] = { bits[MCTS_X], bits[MCTS_O] };
+    next[side] |= 1ULL << cell;
+    MctsNode *child = newNode(&t->arena, r, next, cell, completesLine(r, next[side], cell) ? side : -1);
+    if (!child) return NULL;
+    node->untried &= ~(1ULL << cell);
+    child->sibling = node->child;
+    node->child = child;
+    return child;
+}
+
+// Random moves until someone completes a line or the board is full. Returns the winner or MCTS_DRAW
+static int rollout(const MnkRules *r, MnkBits bits[2], int side, Rng *rng) {
+    unsigned char cells[MNK_MAX_CELLS];
+    int count = 0;
+    for (MnkBits m = ~(bits[MCTS_X] | bits[MCTS_O]) & r->fullMask; m; m &= m - 1) cells[count++] = (unsigned char)lowestBit(m);
+    while (count > 0) {
+        int i = rngRange(rng, count), cell = cells[i];
+        cells[i] = cells[--count];
+        bits[side] |= 1ULL << cell;
+        if (completesLine(r, bits[side], cell)) return side;
+        side ^= 1;
+    }
+    return MCTS_DRAW;
+}
+
+// One playout: select down the tree, add a node, play randomly to the end, credit the result along the path
+static void playout(TreeJob *job) {
+    MctsTree *t = job->tree;
+    const MnkRules *r = job->rules;
+    MnkBits bits[2] = { t->rootBits[MCTS_X], t->rootBits[MCTS_O] };
+    MctsNode *path[MNK_MAX_CELLS + 1];
+    MctsNode *node = t->root;
+    int depth = 0, side = MCTS_O; // the AI is to move at the root
+    path[depth++] = node;
+
+    while (node->result < 0 && !node->untried && node->child) {
+        node = selectChild(node);
+        bits[side] |= 1ULL << node->move;
+        side ^= 1;
+        path[depth++] = node;
+    }
+    if (node->result < 0 && node->untried) {
+        MctsNode *child = expand(t, r, node, bits, side, &job->rng);
+        if (child) {
+            bits[side] |= 1ULL << child->move;
+            side ^= 1;
+            node = child;
+            path[depth++] = node;
+        } else { // a full arena: play out from the leaf without growing the tree
+            job->truncated++;
+        }
+    }
+    int result = (node->result >= 0) ? node->result : rollout(r, bits, side, &job->rng);
+
+    // The root was reached by X's move, its children by O's, and so on down
+    for (int i = 0; i < depth; i++) {
+        int mover = (i % 2 == 0) ? MCTS_X : MCTS_O;
+        path[i]->visits++;
+        path[i]->wins += (result == MCTS_DRAW) ? 0.5f : (result == mover) ? 1.0f : 0.0f;
+    }
+    if (depth - 1 > job->maxDepth) job->maxDepth = depth - 1;
+    job->playouts++;
+}
+
+static int limitReached(const MctsLimits *l) {
+    return (l->stop && atomic_load(l->stop)) || (l->deadlineNs && metricsNowNs() >= l->deadlineNs);
+}
+
+static void growTree(void *arg) {
+    TreeJob *job = arg;
+    while (job->budget < 0 || job->playouts < job->budget) {
+        if (job->playouts % LIMIT_CHECK_PLAYOUTS == 0 && limitReached(job->limits)) break;
+        playout(job);
+    }
+}
+
+static MctsNode *findChild(const MctsNode *node, int move) {
+    for (MctsNode *c = node->child; c; c = c->sibling)
+        if (c->move == move) return c;
+    return NULL;
+}
+
+static size_t subtreeBytes(const MctsNode *node) {
+    size_t bytes = (sizeof(MctsNode) + 15) & ~(size_t)15; // as arenaAlloc rounds it
+    for (const MctsNode *c = node->child; c; c = c->sibling) bytes += subtreeBytes(c);
+    return bytes;
+}
+
+// Copy of node and everything under it, children in the same order so the search plays out the same
+static MctsNode *copySubtree(MctsArena *a, const MctsNode *node) {
+    MctsNode *copy = arenaAlloc(a, sizeof(MctsNode));
+    *copy = *node;
+    MctsNode **link = &copy->child;
+    for (const MctsNode *c = node->child; c; c = c->sibling) {
+        *link = copySubtree(a, c);
+        link = &(*link)->sibling;
+    }
+    *link = NULL;
+    return copy;
+}
+
+// The siblings of a kept subtree stay in the arena until the game ends, so a long game fills it and the tree
+// stops growing. Past the high-water mark the subtree moves to a fresh arena instead. NULL if it is too big to
+// leave room for the search or there is no memory for the copy: then the caller starts over
+static MctsNode *compactSubtree(MctsArena *a, const MctsNode *keep) {
+    if (subtreeBytes(keep) > a->size / HIGH_WATER_DIVISOR) return NULL;
+    MctsArena fresh = { malloc(a->size), a->size, 0 };
+    if (!fresh.base) return NULL;
+    MctsNode *root = copySubtree(&fresh, keep);
+    root->sibling = NULL;
+    free(a->base);
+    *a = fresh;
+    return root;
+}
+
+// Point the tree's root at the position to search. Since the last search the AI played one move and the
+// opponent answered: if the tree has both, their subtree becomes the root. Otherwise (first move, new game,
+// a position the tree never reached) the arena starts over with a fresh root
+static void prepareRoot(MctsTree *t, const MnkRules *r, const MnkBits bits[2]) {
+    MctsNode *node = NULL;
+    int sameRules = t->width == r->width && t->height == r->height && t->k == r->k;
+    if (t->root && sameRules && (t->rootBits[MCTS_X] & ~bits[MCTS_X]) == 0 && (t->rootBits[MCTS_O] & ~bits[MCTS_O]) == 0) {
+        MnkBits added[2] = { bits[MCTS_X] & ~t->rootBits[MCTS_X], bits[MCTS_O] & ~t->rootBits[MCTS_O] };
+        if (!added[MCTS_X] && !added[MCTS_O]) {
+            node = t->root; // same position again
+        } else if (popCount(added[MCTS_X]) == 1 && popCount(added[MCTS_O]) == 1) {
+            node = findChild(t->root, lowestBit(added[MCTS_O]));
+            if (node) node = findChild(node, lowestBit(added[MCTS_X]));
+        }
+        if (node && t->arena.used > t->arena.size / HIGH_WATER_DIVISOR) node = compactSubtree(&t->arena, node);
+    }
+    if (!node) {
+        t->arena.used = 0;
+        node = newNode(&t->arena, r, bits, -1, -1);
+    }
+    t->root = node;
+    t->rootBits[MCTS_X] = bits[MCTS_X];
+    t->rootBits[MCTS_O] = bits[MCTS_O];
+    t->width = r->width;
+    t->height = r->height;
+    t->k = r->k;
+}
+
+int mctsInit(MctsContext *ctx, int parallel) {
+    memset(ctx, 0, sizeof(*ctx));
+    if (parallel) poolInit(0);
+    int trees = parallel ? poolThreadCount() : 1;
+    if (trees < 1) trees = 1;
+    if (trees > MCTS_MAX_TREES) trees = MCTS_MAX_TREES;
+    for (int i = 0; i < trees; i++) {
+        MctsArena *a = &ctx->trees[i].arena;
+        a->base = malloc(MCTS_ARENA_BYTES);
+        if (!a->base) break; // fewer trees, if there is at least one
+        a->size = MCTS_ARENA_BYTES;
+        ctx->treeCount++;
+    }
+    return ctx->treeCount > 0;
+}
+
+void mctsNewGame(MctsContext *ctx) {
+    for (int i = 0; i < ctx->treeCount; i++) {
+        ctx->trees[i].arena.used = 0;
+        ctx->trees[i].root = NULL;
+    }
+}
+
+void mctsFree(MctsContext *ctx) {
+    for (int i = 0; i < ctx->treeCount; i++) free(ctx->trees[i].arena.base);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+Move mctsFindBestMove(MctsContext *ctx, const MnkRules *r, const char *board, int difficulty,
+                      const MnkOptions *options, SearchStats *stats) {
+    static const long difficultyPlayouts[4] = { 2000, 200, 2000, 20000 };
+    unsigned long long start = metricsNowNs();
+    MnkBits bits[2] = { 0, 0 };
+    for (int i = 0; i < r->cells; i++) {
+        if (board[i] == 'X') bits[MCTS_X] |= 1ULL << i;
+        else if (board[i] == 'O') bits[MCTS_O] |= 1ULL << i;
+    }
+
+    MctsLimits limits = { options ? options->stop : NULL, 0 };
+    if (options && options->timeLimitMs) limits.deadlineNs = start + options->timeLimitMs * 1000000ULL;
+    long budget = (options && options->nodeLimit) ? options->nodeLimit : -1;
+    if (budget < 0 && !limits.deadlineNs) budget = difficultyPlayouts[(difficulty >= 1 && difficulty <= 3) ? difficulty : 0];
+
+    // Same seed, same tree count, same playout budget: same move
+    int trees = (options && options->parallel) ? ctx->treeCount : 1;
+    TreeJob jobs[MCTS_MAX_TREES];
+    long inherited = 0;
+    for (int i = 0; i < trees; i++) {
+        MctsTree *t = &ctx->trees[i];
+        prepareRoot(t, r, bits);
+        inherited += t->root->visits;
+        jobs[i] = (TreeJob){ t, r, &limits, budget < 0 ? -1 : budget / trees + (i < budget % trees), {0}, 0, 0, 0 };
+        rngSeed(&jobs[i].rng, (options ? options->seed : 0) + (unsigned long long)i);
+    }
+    if (trees > 1) {
+        TaskGroup group;
+        taskGroupInit(&group);
+        for (int i = 0; i < trees; i++) poolSpawn(&group, growTree, &jobs[i]);
+        poolWait(&group);
+    } else {
+        growTree(&jobs[0]);
+    }
+
+    // Root-parallel: add up every tree's visits per move and play the most visited, ties to more wins
+    long visits[MNK_MAX_CELLS] = {0};
+    float wins[MNK_MAX_CELLS] = {0};
+    long playouts = 0, truncated = 0;
+    int maxDepth = 0;
+    for (int i = 0; i < trees; i++) {
+        for (MctsNode *c = ctx->trees[i].root->child; c; c = c->sibling) {
+            visits[c->move] += c->visits;
+            wins[c->move] += c->wins;
+        }
+        playouts += jobs[i].playouts;
+        truncated += jobs[i].truncated;
+        if (jobs[i].maxDepth > maxDepth) maxDepth = jobs[i].maxDepth;
+    }
+    int cell = -1;
+    for (int i = 0; i < r->cells; i++)
+        if (visits[i] && (cell < 0 || visits[i] > visits[cell] || (visits[i] == visits[cell] && wins[i] > wins[cell])))
+            cell = i;
+    if (cell < 0) { // stopped before the first playout: the most central free cell
+        for (int i = 0; i < r->cells && cell < 0; i++)
+            if (board[r->order[i]] == ' ') cell = r->order[i];
+    }
+
+    if (stats) {
+        memset(stats, 0, sizeof(*stats));
+        stats->nodes = playouts;
+        stats->ttHits = inherited;
+        stats->cutoffs = truncated;
+        stats->maxDepth = maxDepth;
+        metricsFinish(stats, start);
+    }
+    return (Move){cell / r->width, cell % r->width};
+}
@@ -0,0 +1,46 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include "mnk.h"
+
+// Monte Carlo tree search (UCT) for any m,n,k board: random playouts instead of a heuristic, so its strength
+// follows the budget rather than the board size. Root-parallel: with options->parallel every pool thread grows
+// its own tree from the same position and the root visit counts are added up at the end.
+// Nodes come from one bump-pointer arena per tree, reset by mctsNewGame(); between the turns of a game the
+// subtree under the moves actually played is kept, so earlier playouts still count. Once the arena is half full
+// the kept subtree is copied to a fresh one, leaving the discarded branches behind
+#define MCTS_MAX_TREES 16
+#define MCTS_ARENA_BYTES (8u << 20) // per tree, about 200k nodes
+
+typedef struct MctsNode MctsNode; // mcts.c
+
+typedef struct {
+    unsigned char *base;
+    size_t size, used;
+} MctsArena;
+
+typedef struct {
+    MctsArena arena;
+    MctsNode *root;      // NULL until the first search of a game
+    MnkBits rootBits[2]; // position at the root, X then O
+    int width, height, k; // rules of that position
+} MctsTree;
+
+typedef struct {
+    int treeCount; // trees with an arena: one per pool thread, or 1
+    MctsTree trees[MCTS_MAX_TREES];
+} MctsContext;
+
+int mctsInit(MctsContext *ctx, int parallel); // allocates the arenas, 0 if out of memory
+void mctsNewGame(MctsContext *ctx);           // forget every tree: the arenas start over
+void mctsFree(MctsContext *ctx);
+
+// AI plays 'O', like mnkFindBestMove. Budget: options->nodeLimit playouts and/or options->timeLimitMs; without
+// either the difficulty picks the playouts (Easy 200, Medium 2000, Hard 20000). options->stop ends it early and
+// options->seed fixes the playouts. stats->nodes counts this search's playouts, stats->ttHits the playouts
+// inherited from earlier turns, stats->cutoffs the playouts that found the arena full and could not grow the
+// tree, stats->maxDepth the deepest tree node. options and stats may be NULL
+Move mctsFindBestMove(MctsContext *ctx, const MnkRules *rules, const char *board, int difficulty,
+                      const MnkOptions *options, SearchStats *stats);
+
+#endif
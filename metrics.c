@@ -0,0 +1,149 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // clock_gettime under -std=c11
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "metrics.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <sys/resource.h>
+#endif
+
+static FILE *sinkFile = NULL;
+static MetricsFormat sinkFormat = METRICS_TEXT;
+static int csvHeaderWritten = 0;
+
+unsigned long long metricsNowNs(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (unsigned long long)(now.QuadPart / freq.QuadPart) * 1000000000ULL +
+           (unsigned long long)(now.QuadPart % freq.QuadPart) * 1000000000ULL / freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+int metricsMemory(size_t *rss, size_t *peakRss) {
+    *rss = *peakRss = 0;
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    *rss = pmc.WorkingSetSize;
+    *peakRss = pmc.PeakWorkingSetSize;
+    return 1;
+#else
+    // Linux: VmRSS / VmHWM from /proc. Other POSIX systems only have the peak through getrusage
+    FILE *fp = fopen("/proc/self/status", "r");
+    if (fp) {
+        char line[128];
+        unsigned long kb;
+        while (fgets(line, sizeof(line), fp)) {
+            if (sscanf(line, "VmRSS: %lu kB", &kb) == 1) *rss = (size_t)kb * 1024;
+            else if (sscanf(line, "VmHWM: %lu kB", &kb) == 1) *peakRss = (size_t)kb * 1024;
+        }
+        fclose(fp);
+        if (*rss) return 1;
+    }
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    *peakRss = (size_t)usage.ru_maxrss;        // bytes on macOS
+#else
+    *peakRss = (size_t)usage.ru_maxrss * 1024; // kilobytes elsewhere
+#endif
+    return 1;
+#endif
+}
+
+void metricsFinish(SearchStats *stats, unsigned long long startNs) {
+    stats->elapsedNs = metricsNowNs() - startNs;
+    metricsMemory(&stats->rssBytes, &stats->peakRssBytes);
+}
+
+void metricsSetSink(FILE *out, MetricsFormat format) {
+    sinkFile = out;
+    sinkFormat = format;
+    csvHeaderWritten = 0;
+}
+
+int metricsSinkFromEnv(void) {
+    const char *value = getenv("TTT_METRICS");
+    if (!value) return 0;
+    if (strcmp(value, "csv") == 0) metricsSetSink(stdout, METRICS_CSV);
+    else if (strcmp(value, "json") == 0) metricsSetSink(stdout, METRICS_JSON);
+    else metricsSetSink(stdout, METRICS_TEXT);
+    return 1;
+}
+
+void metricsReport(const char *label, const SearchStats *stats) {
+    if (!sinkFile) return;
+    if (sinkFormat == METRICS_CSV && !csvHeaderWritten) {
+        fprintf(sinkFile, "label,elapsed_ns,nodes,max_depth,cutoffs,tt_hits,rss_bytes,peak_rss_bytes\n");
+        csvHeaderWritten = 1;
+    }
+    metricsWrite(sinkFile, sinkFormat, label, stats);
+    fflush(sinkFile);
+}
+
+#ifdef SEARCH_TELEMETRY
+static void writeLongs(FILE *out, const char *name, const long *values, int count) {
+    fprintf(out, "\"%s\":[", name);
+    for (int i = 0; i < count; i++) fprintf(out, i ? ",%ld" : "%ld", values[i]);
+    fprintf(out, "],");
+}
+
+// The "telemetry" member of a JSON record. Plies past the deepest one reached are left out
+static void writeTelemetry(FILE *out, const SearchStats *s) {
+    const SearchTelemetry *t = &s->telemetry;
+    int plies = s->nodes ? s->maxDepth + 1 : 0;
+    if (plies > TELEMETRY_PLIES) plies = TELEMETRY_PLIES;
+    long cutoffs = 0, firstMove = 0;
+    for (int i = 0; i < TELEMETRY_PLIES; i++) {
+        cutoffs += t->cutoffs[i];
+        firstMove += t->firstMoveCutoffs[i];
+    }
+    fprintf(out, ",\"telemetry\":{");
+    writeLongs(out, "nodes_per_ply", t->nodes, plies);
+    writeLongs(out, "cutoffs_per_ply", t->cutoffs, plies);
+    writeLongs(out, "first_move_cutoffs_per_ply", t->firstMoveCutoffs, plies);
+    // Branching factor: moves searched per expanded node. Every node but the root's children has its parent in the tree
+    fprintf(out, "\"first_move_cutoff_rate\":%.4f,\"ebf\":%.3f,\"leaf_evals\":%ld,\"interior_evals\":%ld,"
+                 "\"eval_ns\":%llu,\"clock_ns\":%llu}",
+            cutoffs ? (double)firstMove / cutoffs : 0.0, t->expanded ? (double)(s->nodes - t->nodes[0]) / t->expanded : 0.0,
+            s->nodes - t->interiorEvals, t->interiorEvals, t->evalNs, t->clockNs);
+}
+#endif
+
+void metricsWrite(FILE *out, MetricsFormat format, const char *label, const SearchStats *s) {
+    switch (format) {
+    case METRICS_CSV:
+        fprintf(out, "%s,%llu,%ld,%d,%ld,%ld,%zu,%zu\n", label, s->elapsedNs, s->nodes, s->maxDepth,
+                s->cutoffs, s->ttHits, s->rssBytes, s->peakRssBytes);
+        break;
+    case METRICS_JSON:
+        fprintf(out, "{\"label\":\"%s\",\"elapsed_ns\":%llu,\"nodes\":%ld,\"max_depth\":%d,\"cutoffs\":%ld,"
+                     "\"tt_hits\":%ld,\"rss_bytes\":%zu,\"peak_rss_bytes\":%zu",
+                label, s->elapsedNs, s->nodes, s->maxDepth, s->cutoffs, s->ttHits, s->rssBytes, s->peakRssBytes);
+#ifdef SEARCH_TELEMETRY
+        writeTelemetry(out, s);
+#endif
+        fprintf(out, "}\n");
+        break;
+    default:
+        fprintf(out, "%s\nTime taken for move: %.6lf seconds\nDepth: %d\nRecurses: %ld\nCutoffs: %ld\n"
+                     "TT hits: %ld (%.1f%% of recurses answered from the table)\n"
+                     "Memory in use: %zu KB\nPeak memory: %zu KB\n",
+                label, s->elapsedNs / 1e9, s->maxDepth, s->nodes, s->cutoffs, s->ttHits,
+                s->nodes ? 100.0 * s->ttHits / s->nodes : 0.0, s->rssBytes / 1024, s->peakRssBytes / 1024);
+        break;
+    }
+}
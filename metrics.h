@@ -0,0 +1,51 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+// Search telemetry for tuning move ordering and pruning. Only in builds with -DSEARCH_TELEMETRY: otherwise
+// neither the struct nor the counting exists, so normal builds pay nothing. Filled in by minimax_improved.c
+#define TELEMETRY_PLIES 10
+#ifdef SEARCH_TELEMETRY
+#define TELEMETRY(...) __VA_ARGS__
+typedef struct {
+    long nodes[TELEMETRY_PLIES];            // per ply below the root (0 = the root's children)
+    long cutoffs[TELEMETRY_PLIES];
+    long firstMoveCutoffs[TELEMETRY_PLIES]; // cutoffs caused by the first move tried
+    long expanded;                          // nodes whose moves were searched, for the branching factor
+    long interiorEvals;                     // evaluated, but not decided by it; the rest of the nodes are leaves
+    unsigned long long evalNs;              // time in evaluate(), clock overhead subtracted
+    unsigned long long clockNs;             // cost of one clock read, measured per search
+} SearchTelemetry;
+#else
+#define TELEMETRY(...)
+#endif
+
+// Per-move engine statistics. Engines fill this in and hand it back; they never print
+typedef struct {
+    unsigned long long elapsedNs; // wall time of the whole move
+    long nodes;                   // recurses: positions visited by the search
+    int maxDepth;                 // deepest ply reached
+    long cutoffs;                 // alpha-beta prunes
+    long ttHits;                  // nodes answered from the transposition table
+    size_t rssBytes;              // resident memory after the move, 0 if unknown
+    size_t peakRssBytes;          // peak resident memory of the process, 0 if unknown
+#ifdef SEARCH_TELEMETRY
+    SearchTelemetry telemetry;    // written as a "telemetry" object by the JSON format
+#endif
+} SearchStats;
+
+typedef enum { METRICS_TEXT, METRICS_CSV, METRICS_JSON } MetricsFormat;
+
+unsigned long long metricsNowNs(void);           // monotonic clock in nanoseconds
+int metricsMemory(size_t *rss, size_t *peakRss); // 1 if the platform reported the values
+void metricsFinish(SearchStats *stats, unsigned long long startNs); // fill in elapsed time and memory
+
+// Opt-in output: nothing is written until a sink is set
+void metricsSetSink(FILE *out, MetricsFormat format);
+int metricsSinkFromEnv(void); // TTT_METRICS=text|csv|json to stdout, returns 1 if set
+void metricsReport(const char *label, const SearchStats *stats);
+void metricsWrite(FILE *out, MetricsFormat format, const char *label, const SearchStats *stats);
+
+#endif
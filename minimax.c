@@ -1,13 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h> 
 #include "minimax.h"
 
 #define SIZE 3
 
-static char player = 'O';     // AI
-static char opponent = 'X';   // Human
-
 static int max(int a, int b) { return (a > b) ? a : b; }
 static int min(int a, int b) { return (a < b) ? a : b; }
 
@@ -19,7 +15,8 @@ static int isMovesLeft(char board[SIZE][SIZE]) {
     return 0;
 }
 
-static int evaluate(char b[SIZE][SIZE]) {
+static int evaluate(const SearchContext *ctx, char b[SIZE][SIZE]) {
+    char player = ctx->player, opponent = ctx->opponent;
     // Rows
     for (int row = 0; row < SIZE; row++) {
         if (b[row][0] == b[row][1] && b[row][1] == b[row][2]) {
@@ -50,8 +47,11 @@ static int evaluate(char b[SIZE][SIZE]) {
     return 0; // No win
 }
 
-static int minimax(char board[SIZE][SIZE], int depth, int isMax) {
-    int score = evaluate(board);
+static int minimax(SearchContext *ctx, char board[SIZE][SIZE], int depth, int isMax) {
+    SearchStats *stats = &ctx->stats;
+    stats->nodes++;
+    if (depth > stats->maxDepth) stats->maxDepth = depth;
+    int score = evaluate(ctx, board);
     if (score == 10) return score - depth;  // favor faster wins
     if (score == -10) return score + depth; // favor slower losses
     if (!isMovesLeft(board)) return 0;
@@ -61,8 +61,8 @@ static int minimax(char board[SIZE][SIZE], int depth, int isMax) {
         for (int i = 0; i < SIZE; i++) {
             for (int j = 0; j < SIZE; j++) {
                 if (board[i][j] == ' ') {
-                    board[i][j] = player;
-                    best = max(best, minimax(board, depth + 1, 0));
+                    board[i][j] = ctx->player;
+                    best = max(best, minimax(ctx, board, depth + 1, 0));
                     board[i][j] = ' ';
                 }
             }
@@ -73,8 +73,8 @@ static int minimax(char board[SIZE][SIZE], int depth, int isMax) {
         for (int i = 0; i < SIZE; i++) {
             for (int j = 0; j < SIZE; j++) {
                 if (board[i][j] == ' ') {
-                    board[i][j] = opponent;
-                    best = min(best, minimax(board, depth + 1, 1));
+                    board[i][j] = ctx->opponent;
+                    best = min(best, minimax(ctx, board, depth + 1, 1));
                     board[i][j] = ' ';
                 }
             }
@@ -83,12 +83,11 @@ static int minimax(char board[SIZE][SIZE], int depth, int isMax) {
     }
 }
 
-Move findBestMove(char board[SIZE][SIZE]) {
-    //clock to time ex time of minimax
-    clock_t start, end;
-    double cpu_time_used;
-    start = clock();
-    
+Move findBestMoveBasic(SearchContext *ctx, char board[SIZE][SIZE]) {
+    // time the whole move with the monotonic clock
+    unsigned long long start = metricsNowNs();
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+
     int bestVal = -1000;
     Move bestMoves[9];
     int bestCount = 0;
@@ -100,9 +99,15 @@ Move findBestMove(char board[SIZE][SIZE]) {
             if (board[i][j] == ' ')
                 emptyCount++;
 
+    if (emptyCount == 0) { // full board: nothing to play
+        searchContextFinish(ctx, start);
+        return (Move){-1, -1};
+    }
+
     // If is AI's first move and center is free
     if (emptyCount >= 8 && board[1][1] == ' ') {
         Move center = {1, 1};
+        searchContextFinish(ctx, start);
         return center;
     }
 
@@ -110,8 +115,8 @@ Move findBestMove(char board[SIZE][SIZE]) {
     for (int i = 0; i < SIZE; i++) {
         for (int j = 0; j < SIZE; j++) {
             if (board[i][j] == ' ') {
-                board[i][j] = player;
-                int moveVal = minimax(board, 0, 0);
+                board[i][j] = ctx->player;
+                int moveVal = minimax(ctx, board, 0, 0);
                 board[i][j] = ' ';
 
                 if (moveVal > bestVal) {
@@ -125,14 +130,9 @@ Move findBestMove(char board[SIZE][SIZE]) {
         }
     }
 
-    // stop timing
-    end = clock();  
-    cpu_time_used = ((double)(end - start)) / CLOCKS_PER_SEC;
-    printf("\nExecution time for normal minimax: %.6f seconds\n", cpu_time_used);
-
-    srand(time(NULL)); // ensure randomness
-    int choice = rand() % bestCount; //get a random best move if more than 1
+    int choice = rngRange(&ctx->rng, bestCount); //get a random best move if more than 1
 
-    printf("\nbest move is: %d,%d", bestMoves[choice],bestMoves[choice]);
+    // stop timing, statistics stay in the context
+    searchContextFinish(ctx, start);
     return bestMoves[choice];
 }
@@ -1,13 +1,83 @@
 #ifndef MINIMAX_H
 #define MINIMAX_H
 
+#include <string.h>
+#include "metrics.h"
+#include "rng.h"
+
 #define SIZE 3
+#define TT_SIZE 4096 // transposition table entries per context, power of two
 
 typedef struct {
     int row;
     int col;
 } Move;
 
-Move findBestMove(char board2D[SIZE][SIZE], int difficulty);
+// Transposition table entry (minimax_improved.c)
+typedef struct {
+    unsigned long long key;
+    short score;
+    signed char draft; // remaining depth the score was searched to
+    unsigned char flag;
+    signed char move;  // best move in canonical coordinates, -1 if none
+} TTEntry;
+
+// Everything a search reads or writes. Contexts share nothing, so separate games can search at the same time
+// on separate threads, one context each. Set up with searchContextInit()
+typedef struct {
+    char player, opponent;  // the AI's mark and the other side's
+    int difficulty;         // 1 Easy, 2 Medium, 3 Hard
+    int maxDepth;           // depth limit of the current search, chosen from the difficulty
+    long nodeLimit;            // budget of one findBestMove in nodes, 0 = the difficulty's (searchNodeBudget)
+    unsigned long timeLimitMs; // and in milliseconds, 0 = the difficulty's (searchTimeBudgetMs)
+    int useTablebase;       // Hard mode answers from the precomputed table instead of searching (default 1)
+    int memoryStats;        // fill in stats.rssBytes/peakRssBytes too (default 1); costs a system call per move
+    int ordering;           // root moves center first, then by the last iteration's scores (default 1); 0 = row-major
+    int pvs;                // principal variation search: null-window probes, re-searched when they fail (default 1)
+    long nodeBudget;            // limits of the running search
+    unsigned long long deadlineNs;
+    int halted;                 // the budget ran out: the iteration under way is thrown away
+    int horizonHit;             // the iteration under way cut some line off before the end of the game
+    Rng rng;                // every random choice
+    SearchStats stats;      // counters of the last search
+    TTEntry table[TT_SIZE]; // findBestMove only; kept between the turns of one game
+} SearchContext;
+
+static inline void searchContextInit(SearchContext *ctx, char player, int difficulty, unsigned long long seed) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->player = player;
+    ctx->opponent = (player == 'X') ? 'O' : 'X';
+    ctx->difficulty = difficulty;
+    ctx->maxDepth = 9;
+    ctx->useTablebase = 1;
+    ctx->memoryStats = 1;
+    ctx->ordering = 1;
+    ctx->pvs = 1;
+    rngSeed(&ctx->rng, seed);
+}
+
+// Default budgets per difficulty. They bound how long one move can take rather than set the strength: a 3x3
+// search needs far less, but the larger-board engines get the same time budget in the game
+static inline long searchNodeBudget(int difficulty) {
+    return (difficulty == 1) ? 2000 : (difficulty == 2) ? 20000 : 200000;
+}
+static inline unsigned long searchTimeBudgetMs(int difficulty) {
+    return (difficulty == 1) ? 250 : (difficulty == 2) ? 1000 : 3000;
+}
+
+// New game: forget the previous game's positions
+static inline void searchContextNewGame(SearchContext *ctx) {
+    memset(ctx->table, 0, sizeof(ctx->table));
+}
+
+// Engines call this last: stop the clock on ctx->stats
+static inline void searchContextFinish(SearchContext *ctx, unsigned long long startNs) {
+    if (ctx->memoryStats) metricsFinish(&ctx->stats, startNs);
+    else ctx->stats.elapsedNs = metricsNowNs() - startNs;
+}
+
+// Best move for ctx->player, {-1, -1} on a full board; ctx->stats has the counters afterwards
+Move findBestMove(SearchContext *ctx, char board2D[SIZE][SIZE]);      // minimax_improved.c
+Move findBestMoveBasic(SearchContext *ctx, char board2D[SIZE][SIZE]); // minimax.c: plain full-depth minimax, no pruning
 
 #endif
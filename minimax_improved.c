@@ -1,221 +1,429 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <windows.h>
-#include <psapi.h>
 #include "minimax.h"
+#include "tablebase.h"
 
 #define SIZE 3
-#define BOARD_CELLS (SIZE * SIZE)
 #define INF 10000
+#define DRAFT_COMPLETE 9     // table entry searched to the end of the game
+#define CLOCK_CHECK_NODES 256 // nodes between two reads of the clock
 
-// Define quick access macro for 1D board | (r,c) into 1D index r*SIZE + c
-#define CELL(board, r, c) ((board)[(r) * SIZE + (c)])
-
-static char player = 'O'; // AI
-static char opponent = 'X'; // Human
-static int currentDifficulty = 3;
-static int pureEvaluationMode = 0;
-
-// Get memory usage statistics. Does not affect alogrithm at all
-void printMemoryUsage() {
-    PROCESS_MEMORY_COUNTERS_EX pmc;
-    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
-        SIZE_T memUsed = pmc.WorkingSetSize; // bytes currently in RAM
-        SIZE_T privateBytes = pmc.PrivateUsage; // committed private memory
-        printf("Memory in use: %zu KB\n", memUsed / 1024);
-        printf("Private bytes: %zu KB\n", privateBytes / 1024);
-    } else {
-        printf("Unable to get memory info\n");
+// All search state lives in the SearchContext; this file only has constant tables
+
+// Bitboard layout: bit (r * SIZE + c) is set when that cell holds the mark. One 9-bit mask per symbol
+#define BB_X 0
+#define BB_O 1
+#define FULL_MASK 0x1FF
+#define CENTER_MASK 0x010 // (1,1)
+#define CORNER_MASK 0x145 // (0,0) (0,2) (2,0) (2,2)
+#define EDGE_MASK   0x0AA // (0,1) (1,0) (1,2) (2,1)
+
+typedef struct {
+    unsigned short bits[2];      // bits[BB_X] and bits[BB_O]
+    unsigned long long keys[8];  // Zobrist key of this board under each of the 8 symmetries
+    // Evaluation terms, kept up to date by toggleCell so a leaf only reads them
+    unsigned char lines[8];  // per line: X marks + 4 * O marks
+    unsigned int terms;      // per side, packed by TERM_*: lines where it has two and the other none, full lines
+    short positional[2];     // sum of cellWeight over each side's marks
+    unsigned char empty;     // empty cells
+} Bitboard;
+
+// Byte offsets in Bitboard.terms; each count is at most 8 so the bytes never carry into each other
+#define TERM_TWOS(side)   (8 * (side))
+#define TERM_THREES(side) (16 + 8 * (side))
+#define TERM(b, field) (int)(((b)->terms >> (field)) & 0xFF)
+
+// All 8 winning lines: 3 rows, 3 columns, 2 diagonals
+static const unsigned short lineMasks[8] = {
+    0x007, 0x038, 0x1C0, // rows
+    0x049, 0x092, 0x124, // columns
+    0x111, 0x054         // diagonals
+};
+
+// Lines through each cell, as a bit per lineMasks index
+static const unsigned char cellLines[9] = { 0x49, 0x11, 0xA1, 0x0A, 0xD2, 0x22, 0x8C, 0x14, 0x64 };
+
+// Positional weights: center(5) > corners(3) > edges(2)
+static const short cellWeight[9] = { 3, 2, 3, 2, 5, 2, 3, 2, 3 };
+
+// Search order by groups: center first, then corners, then edges. Lowest bit first inside a group
+static const unsigned short orderGroups[3] = { CENTER_MASK, CORNER_MASK, EDGE_MASK };
+
+static inline int sideOf(char symbol) { return symbol == 'X' ? BB_X : BB_O; }
+
+static inline int popCount(unsigned int m) { return __builtin_popcount(m); }
+static inline int lowestBit(unsigned int m) { return __builtin_ctz(m); }
+
+static inline unsigned short emptyMask(const Bitboard *b) {
+    return (unsigned short)(~(b->bits[BB_X] | b->bits[BB_O]) & FULL_MASK);
+}
+
+// ---------------- Transposition table ----------------
+// Positions are keyed on their canonical form under the 8 symmetries of the square (D4): the board keeps
+// one Zobrist key per symmetry and the smallest of the 8 is the key, so rotated/reflected copies share an entry.
+#define TT_EXACT 0
+#define TT_LOWER 1 // score is a lower bound (search failed high)
+#define TT_UPPER 2 // score is an upper bound (search failed low)
+
+// symmetry[t][i] = where cell i lands under symmetry t
+static const unsigned char symmetry[8][9] = {
+    {0,1,2,3,4,5,6,7,8}, // identity
+    {2,5,8,1,4,7,0,3,6}, // rotate 90
+    {8,7,6,5,4,3,2,1,0}, // rotate 180
+    {6,3,0,7,4,1,8,5,2}, // rotate 270
+    {2,1,0,5,4,3,8,7,6}, // mirror left-right
+    {6,7,8,3,4,5,0,1,2}, // mirror top-bottom
+    {0,3,6,1,4,7,2,5,8}, // main diagonal
+    {8,5,2,7,4,1,6,3,0}  // anti diagonal
+};
+// inverseSymmetry[t][j] = the cell that lands on j under symmetry t (rotations by 90 and 270 swap)
+static const unsigned char inverseSymmetry[8][9] = {
+    {0,1,2,3,4,5,6,7,8}, {6,3,0,7,4,1,8,5,2}, {8,7,6,5,4,3,2,1,0}, {2,5,8,1,4,7,0,3,6},
+    {2,1,0,5,4,3,8,7,6}, {6,7,8,3,4,5,0,1,2}, {0,3,6,1,4,7,2,5,8}, {8,5,2,7,4,1,6,3,0}
+};
+
+// Zobrist keys: splitmix64 from seed 0x5EED, written out so no state is shared between searches
+static const unsigned long long zobrist[2][9] = {
+    {0x09F1FD9D03F0A9B4ULL, 0x553274161BBF8475ULL, 0x5D5BCA4696B343B3ULL,
+     0x70D29B6C7D22528DULL, 0x0BF2B716F9915475ULL, 0x5EB7F92B95387CCAULL,
+     0x296CD0F2C21D7F90ULL, 0x1289A69805C125B1ULL, 0xDAA27FB8DACB9E73ULL},
+    {0x3ED08D59CB3F4727ULL, 0x58A5F17B6C15C659ULL, 0x651AC042FA7B481AULL,
+     0x22AF6AEAA88E8DCCULL, 0x2D2BAE64640ABFB9ULL, 0xAD0E83A710231B07ULL,
+     0x9D30FF2169D91F12ULL, 0xF5FF07C9523504DDULL, 0x1273C823BA66EEC0ULL}
+};
+static const unsigned long long zobristSide = 0x47E1DBE249CB520BULL; // xor'd in when the AI is to move
+static const unsigned long long zobristLevel[4] = { // evaluation differs per difficulty
+    0xBBEA42BD69484ADCULL, 0xC33E61BC6EF9E4C4ULL, 0x752CD583231B5114ULL, 0xE53DC6E1988622E5ULL
+};
+static const unsigned long long zobristAiX = 0x928EB721ED361BA3ULL; // xor'd in when the AI plays X
+
+// What one line adds to Bitboard.terms, by its X + 4 * O count
+#define T(field) (1u << (field))
+static const unsigned int lineTerms[16] = {
+    0, 0, T(TERM_TWOS(BB_X)), T(TERM_THREES(BB_X)),  // no O
+    0, 0, 0, 0,                                      // one O
+    T(TERM_TWOS(BB_O)), 0, 0, 0,                     // two O
+    T(TERM_THREES(BB_O)), 0, 0, 0                    // three O
+};
+#undef T
+
+// Place or remove a mark (xor is its own inverse), keeping all 8 symmetric keys and the evaluation terms
+// up to date. Only the 2-4 lines through the cell change
+static inline void toggleCell(Bitboard *b, int side, int idx) {
+    int delta = (b->bits[side] >> idx & 1) ? -1 : 1;
+    b->bits[side] ^= (unsigned short)(1u << idx);
+    for (int t = 0; t < 8; t++)
+        b->keys[t] ^= zobrist[side][symmetry[t][idx]];
+
+    b->positional[side] += delta * cellWeight[idx];
+    b->empty -= delta;
+    int step = (side == BB_X) ? delta : 4 * delta;
+    for (unsigned int m = cellLines[idx]; m; m &= m - 1) {
+        unsigned char *line = &b->lines[lowestBit(m)];
+        b->terms -= lineTerms[*line];
+        *line += step;
+        b->terms += lineTerms[*line];
     }
 }
 
-//function for getting executuon time. Does not affect alogrithm at all
-static void printStatistics(LARGE_INTEGER start, LARGE_INTEGER freq, int depth, int recurses) {
-    LARGE_INTEGER end;
-    QueryPerformanceCounter(&end);
-    double elapsed = (double)(end.QuadPart - start.QuadPart) / freq.QuadPart;
-    printf("Time taken for move: %lf seconds, \nDepth: %d \nRecurses: %d\n", elapsed, depth, recurses);
-    printMemoryUsage();
+// Set up a whole position at once: keys cell by cell, the evaluation terms by counting each line
+static void loadBoard(Bitboard *b, unsigned short x, unsigned short o) {
+    memset(b, 0, sizeof(*b));
+    b->bits[BB_X] = x;
+    b->bits[BB_O] = o;
+    b->empty = (unsigned char)(SIZE * SIZE - popCount(x | o));
+    for (int side = 0; side < 2; side++) {
+        for (unsigned int m = b->bits[side]; m; m &= m - 1) {
+            int idx = lowestBit(m);
+            b->positional[side] += cellWeight[idx];
+            for (int t = 0; t < 8; t++)
+                b->keys[t] ^= zobrist[side][symmetry[t][idx]];
+        }
+    }
+    for (int line = 0; line < 8; line++) {
+        b->lines[line] = (unsigned char)(popCount(x & lineMasks[line]) + 4 * popCount(o & lineMasks[line]));
+        b->terms += lineTerms[b->lines[line]];
+    }
 }
 
-// Returns 1 if any moves remain. If returns 0, minimax will stop recursion, meaning draw
-static inline int movesLeft(const char *b) {
-    for (int i = 0; i < BOARD_CELLS; i++) if (b[i] == ' ') return 1;
-    return 0;
+// Canonical key of the position and which symmetry produced it
+static inline unsigned long long canonicalKey(const SearchContext *ctx, const Bitboard *b, int isMax, int difficulty,
+                                              int *sym) {
+    int best = 0;
+    for (int t = 1; t < 8; t++)
+        if (b->keys[t] < b->keys[best]) best = t;
+    *sym = best;
+    return b->keys[best] ^ (isMax ? zobristSide : 0) ^ zobristLevel[difficulty] ^
+           (ctx->player == 'X' ? zobristAiX : 0);
+}
+
+// Hard mode scores encode distance to the end (10 - depth). Store them relative to the node so an entry
+// found at a different depth (or on a later turn) still gives the right score. Draws stay 0.
+static inline int scoreToTT(int difficulty, int score, int depth) {
+    return (difficulty == 3 && score != 0) ? score + depth : score;
+}
+static inline int scoreFromTT(int difficulty, int score, int depth) {
+    return (difficulty == 3 && score != 0) ? score - depth : score;
 }
 
-// Function is called when level 3. This is to very clearly see wins/losses. 
-static inline int checkWin(const char *b, char symbol) {
-    for (int i = 0; i < SIZE; i++) //First loop checks all rows and columns. Then checks both diagonals explicitly.
-        if ((CELL(b,i,0)==symbol && CELL(b,i,1)==symbol && CELL(b,i,2)==symbol) ||
-            (CELL(b,0,i)==symbol && CELL(b,1,i)==symbol && CELL(b,2,i)==symbol))
-            return 1; //Returns 1 if symbol has a win, else 0
-    return (CELL(b,0,0)==symbol && CELL(b,1,1)==symbol && CELL(b,2,2)==symbol) ||
-           (CELL(b,0,2)==symbol && CELL(b,1,1)==symbol && CELL(b,2,0)==symbol);
+// Returns 1 if any moves remain. If returns 0, minimax will stop recursion, meaning draw
+static inline int movesLeft(const Bitboard *b) {
+    return b->empty != 0;
 }
 
-//evaluation function (handles all difficulty levels)
-static inline int evaluate(const char *b, int difficulty) {
+//evaluation function (handles all difficulty levels). Reads the terms toggleCell keeps, no board scan
+static inline int evaluate(const SearchContext *ctx, const Bitboard *b, int difficulty) {
+    int ai = sideOf(ctx->player), opp = sideOf(ctx->opponent);
+
     // Hard mode (perfect play): only check wins/losses
     if (difficulty == 3) {
-        if (checkWin(b, player))   return +10;
-        if (checkWin(b, opponent)) return -10;
+        if (TERM(b, TERM_THREES(ai)))  return +10;
+        if (TERM(b, TERM_THREES(opp))) return -10;
         return 0;
     }
 
-    // Positional weights: center > corners > edges (for lvl 1 and 2)
-    static const int weights[SIZE][SIZE] = {{3,2,3},{2,5,2},{3,2,3}}; // weights for all positions
-    int score = 0;
-
-    for (int r = 0; r < SIZE; r++)
-        for (int c = 0; c < SIZE; c++)
-            if (CELL(b,r,c)==player) score += weights[r][c];
-            else if (CELL(b,r,c)==opponent) score -= weights[r][c];
-
-    // Simple 2-in-a-row bonus for medium difficulty
-    if (difficulty >= 2) {
-        for (int i = 0; i < SIZE; i++) {
-            int aiR=0, oppR=0, aiC=0, oppC=0;
-            // For each row/column, count AI and opponent marks.
-            for (int j = 0; j < SIZE; j++) {
-                if (CELL(b,i,j)==player) aiR++; else if (CELL(b,i,j)==opponent) oppR++;
-                if (CELL(b,j,i)==player) aiC++; else if (CELL(b,j,i)==opponent) oppC++;
-            }
-            //If AI has 2 and opponent 0 → score +10 (encourage finishing). If opponent has 2 and AI 0 → subtract 8 (encourage blocking).
-            if (aiR==2 && oppR==0) score += 10; if (oppR==2 && aiR==0) score -= 8;
-            if (aiC==2 && oppC==0) score += 10; if (oppC==2 && aiC==0) score -= 8;
-        }
-    }
+    // Positional weights (for lvl 1 and 2)
+    int score = b->positional[ai] - b->positional[opp];
+
+    // Simple 2-in-a-row bonus for medium difficulty, on all 8 lines
+    //If AI has 2 and opponent 0 → score +10 (encourage finishing). If opponent has 2 and AI 0 → subtract 8 (encourage blocking).
+    if (difficulty >= 2) score += 10 * TERM(b, TERM_TWOS(ai)) - 8 * TERM(b, TERM_TWOS(opp));
+    return score;
+}
+
+#ifdef SEARCH_TELEMETRY
+// evaluate() with its time added to the telemetry
+static int timedEvaluate(SearchContext *ctx, const Bitboard *b, int difficulty) {
+    SearchTelemetry *t = &ctx->stats.telemetry;
+    unsigned long long start = metricsNowNs();
+    int score = evaluate(ctx, b, difficulty);
+    unsigned long long ns = metricsNowNs() - start;
+    t->evalNs += (ns > t->clockNs) ? ns - t->clockNs : 0;
     return score;
 }
 
-// Minimax with alpha-beta pruning
-static int minimax(char *board, int depth, int isMax, int alpha, int beta, int maxDepth, int *ptrRecurse, int *ptrDepthCount) {
-    //increase recursion count
-    (*ptrRecurse)++;
-    // update maximum depth seen so far
-    if (depth > *ptrDepthCount) {
-        *ptrDepthCount = depth;
+// Cheapest of a few back-to-back clock reads: what timing one evaluate() costs by itself
+static unsigned long long clockOverheadNs(void) {
+    unsigned long long best = ~0ULL;
+    for (int i = 0; i < 8; i++) {
+        unsigned long long start = metricsNowNs(), ns = metricsNowNs() - start;
+        if (ns < best) best = ns;
     }
-    // evaluate current board
-    int score = evaluate(board, currentDifficulty);
-
-    if (currentDifficulty == 3) { //Hard mode (full-depth perfect play)
-        if (score == 10 || score == -10) return score - depth;
-        if (!movesLeft(board)) return 0;
-    } else { // Easy/Medium (limited-depth play)
-        if (score >= 1000 || score <= -1000) return score - depth;
-        if (!movesLeft(board) || depth >= maxDepth) return score; //If depth limit reached → use heuristic
+    return best;
+}
+#endif
+
+// Hard mode with the tablebase: index the position and pick one of its optimal cells. -1 if the table has
+// no move there: the position can't come up in a game, or the game is already over
+static int tablebaseMove(SearchContext *ctx, char board2D[SIZE][SIZE]) {
+    static const int pow3[9] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+    int idx = 0;
+    for (int i = 0; i < SIZE * SIZE; i++) {
+        char cell = board2D[i / SIZE][i % SIZE];
+        idx += (cell == 'X' ? 1 : cell == 'O' ? 2 : 0) * pow3[i];
     }
+    unsigned short entry = tablebase[ctx->player == 'O'][idx];
+    unsigned int moves = TB_MOVES(entry);
+    if (TB_VALUE(entry) == TB_UNSOLVED || moves == 0) return -1;
 
-    int best = isMax ? -INF : INF; //Initialize best as -INF for maximizing, +INF for minimizing.
-    char symbol = isMax ? player : opponent;
+    // Same preference as the search: center whenever it is one of the optimal moves
+    if (moves & CENTER_MASK) return 4;
 
-    // Prioritize center and corners first
-    int order[9][2] = {{1,1},{0,0},{0,2},{2,0},{2,2},{0,1},{1,0},{1,2},{2,1}};
+    // Otherwise a random optimal move: skip n set bits then take the lowest
+    for (int n = rngRange(&ctx->rng, popCount(moves)); n > 0; n--) moves &= moves - 1;
+    return lowestBit(moves);
+}
 
-    for (int k = 0; k < 9; k++) {
-        int i = order[k][0], j = order[k][1];
-        if (CELL(board,i,j) != ' ') continue;
+// Fill moves[] in search order and return how many: the table move first, then center, corners, edges.
+// Killer and history tables used to come next; with the table move and PVS in place they changed the bench
+// node counts by 0% (Easy), +0.3% (Medium) and -1.3% (Hard), so they were dropped
+static int orderMoves(unsigned short empty, int ttMove, int moves[9]) {
+    int count = 0;
+    if (ttMove >= 0 && (empty >> ttMove & 1)) {
+        moves[count++] = ttMove;
+        empty &= (unsigned short)~(1u << ttMove);
+    }
+    for (int g = 0; g < 3; g++)
+        for (unsigned short m = empty & orderGroups[g]; m; m &= m - 1) // m & (m - 1) clears the lowest set bit
+            moves[count++] = lowestBit(m);
+    return count;
+}
 
-        // “plays” a move on the board temporarily to find score of that move then keeps going deeper into tree
-        CELL(board,i,j) = symbol;
-        int val = minimax(board, depth + 1, !isMax, alpha, beta, maxDepth, ptrRecurse, ptrDepthCount);
-        CELL(board,i,j) = ' ';
+// Checked before every node: the node budget exactly, the clock every CLOCK_CHECK_NODES nodes
+static inline int outOfBudget(SearchContext *ctx) {
+    if (ctx->halted) return 1;
+    long nodes = ctx->stats.nodes;
+    if (nodes >= ctx->nodeBudget || (nodes % CLOCK_CHECK_NODES == 0 && metricsNowNs() >= ctx->deadlineNs))
+        ctx->halted = 1;
+    return ctx->halted;
+}
 
-        //Update best score (MAX or MIN)
-        if (isMax) { // best = max(best, val), update alpha
-            best = (val > best) ? val : best;
-            alpha = (best > alpha) ? best : alpha;
-        } else { // best = min(best, val), update beta
-            best = (val < best) ? val : best;
-            beta  = (best < beta) ? best : beta;
-        }
-        if (beta <= alpha) break; // if beta <= alpha, no need to explore further. prune branch
-    }
-    return best;
+// The search itself: minimax_kernel.inc once per difficulty and side to move. Each node only calls the
+// kernel for the other side, so findBestMove picks the difficulty once, at the root
+typedef int (*MinimaxKernel)(SearchContext *ctx, Bitboard *board, int depth, int alpha, int beta);
+static int minimaxEasyMax(SearchContext *, Bitboard *, int, int, int);
+static int minimaxEasyMin(SearchContext *, Bitboard *, int, int, int);
+static int minimaxMediumMax(SearchContext *, Bitboard *, int, int, int);
+static int minimaxMediumMin(SearchContext *, Bitboard *, int, int, int);
+static int minimaxHardMax(SearchContext *, Bitboard *, int, int, int);
+static int minimaxHardMin(SearchContext *, Bitboard *, int, int, int);
+
+#define KERNEL_DIFFICULTY 1
+#define KERNEL_MAX 1
+#define KERNEL_SELF minimaxEasyMax
+#define KERNEL_CHILD minimaxEasyMin
+#include "minimax_kernel.inc"
+#define KERNEL_DIFFICULTY 1
+#define KERNEL_MAX 0
+#define KERNEL_SELF minimaxEasyMin
+#define KERNEL_CHILD minimaxEasyMax
+#include "minimax_kernel.inc"
+#define KERNEL_DIFFICULTY 2
+#define KERNEL_MAX 1
+#define KERNEL_SELF minimaxMediumMax
+#define KERNEL_CHILD minimaxMediumMin
+#include "minimax_kernel.inc"
+#define KERNEL_DIFFICULTY 2
+#define KERNEL_MAX 0
+#define KERNEL_SELF minimaxMediumMin
+#define KERNEL_CHILD minimaxMediumMax
+#include "minimax_kernel.inc"
+#define KERNEL_DIFFICULTY 3
+#define KERNEL_MAX 1
+#define KERNEL_SELF minimaxHardMax
+#define KERNEL_CHILD minimaxHardMin
+#include "minimax_kernel.inc"
+#define KERNEL_DIFFICULTY 3
+#define KERNEL_MAX 0
+#define KERNEL_SELF minimaxHardMin
+#define KERNEL_CHILD minimaxHardMax
+#include "minimax_kernel.inc"
+
+// After the AI's root move the opponent is to move: the root only ever calls a Min kernel
+static const MinimaxKernel rootKernels[4] = { NULL, minimaxEasyMin, minimaxMediumMin, minimaxHardMin };
+
+// Stop the clock on ctx->stats
+static Move finishMove(SearchContext *ctx, Move move, unsigned long long start) {
+    searchContextFinish(ctx, start);
+    return move;
 }
 
-// Find best move based on current board and difficulty
-Move findBestMove(char board2D[SIZE][SIZE], int difficulty) {
-    printf("\nMemory usage before entering algorithm:\n");
-    printMemoryUsage();
-    currentDifficulty = difficulty;
-    pureEvaluationMode = (difficulty == 3);
-    int maxDepth = 9; // default maxDepth=9 (search entire game)
-    int recurses = 0;
-    int depthCount = 0;
-
-    // Start timer
-    LARGE_INTEGER start, end, freq;
-    QueryPerformanceFrequency(&freq);
-    QueryPerformanceCounter(&start);
-    
-    // Always take center immediately in Hard mode if available for lvl 3
-    if (difficulty == 3 && board2D[1][1] == ' ') {
-        printf("\nAI Hard mode played center move\n");
-        printStatistics(start, freq, depthCount, recurses);
-        return (Move){1, 1};
+// Find best move for ctx->player based on the board and ctx->difficulty; counters go to ctx->stats
+Move findBestMove(SearchContext *ctx, char board2D[SIZE][SIZE]) {
+    unsigned long long start = metricsNowNs(); // Start timer
+    int difficulty = ctx->difficulty;
+    int side = sideOf(ctx->player);
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+    TELEMETRY(ctx->stats.telemetry.clockNs = clockOverheadNs();)
+    ctx->maxDepth = 9; // default maxDepth=9 (search entire game)
+
+    // Hard mode: perfect-play table lookup, no search needed. Positions it doesn't cover are searched
+    if (difficulty == 3 && ctx->useTablebase) {
+        int cell = tablebaseMove(ctx, board2D);
+        if (cell >= 0) return finishMove(ctx, (Move){cell / SIZE, cell % SIZE}, start);
     }
 
-    // Flatten 2D -> 1D board
-    char board[BOARD_CELLS];
-    memcpy(board, board2D, sizeof(board)); // Flatten the 2D board into 1D board using memcpy. this copies memory row-major
+    // Always take center immediately in Hard mode if available for lvl 3
+    if (difficulty == 3 && board2D[1][1] == ' ')
+        return finishMove(ctx, (Move){1, 1}, start);
 
-    // collect all empty cell coordinates into emptyCells array
+    // Pack the 2D char board into one 9-bit mask per mark, row-major, and collect the empty cells
+    unsigned short marks[2] = {0, 0};
     Move emptyCells[9];
     int emptyCount = 0;
-    for (int r = 0; r < SIZE; r++)
-        for (int c = 0; c < SIZE; c++)
-            if (board2D[r][c] == ' ')
-                emptyCells[emptyCount++] = (Move){r, c};
+    for (int r = 0; r < SIZE; r++) {
+        for (int c = 0; c < SIZE; c++) {
+            if (board2D[r][c] != ' ') marks[sideOf(board2D[r][c])] |= (unsigned short)(1u << (r * SIZE + c));
+            else emptyCells[emptyCount++] = (Move){r, c};
+        }
+    }
+    if (emptyCount == 0) return finishMove(ctx, (Move){-1, -1}, start); // full board: nothing to play
 
     // Difficulty setup
     if (difficulty == 1) {
-        if ((rand() % 100) < 70) { // mostly random
-            Move random = emptyCells[rand() % emptyCount]; // 70% chance for random empty cell, otherwise max depth 2.
-            printf("\nAI Easy mode played random move\n");
-            printStatistics(start, freq, depthCount, recurses);
-            return random;
+        if (rngRange(&ctx->rng, 100) < 70) { // mostly random
+            Move random = emptyCells[rngRange(&ctx->rng, emptyCount)]; // 70% chance for random empty cell, otherwise max depth 2.
+            return finishMove(ctx, random, start);
         }
-        maxDepth = 2;
+        ctx->maxDepth = 2;
     } else if (difficulty == 2) {
         // 20% chance of random move
-        if ((rand() % 100) < 20) {
-            Move random = emptyCells[rand() % emptyCount];
-            printf("\nAI Medium mode played random move\n");
-            printStatistics(start, freq, depthCount, recurses);
-            return random;
-        }
-        maxDepth = 4 + rand() % 2; // maxDepth 4–5 and imperfectChance 20%
+        if (rngRange(&ctx->rng, 100) < 20)
+            return finishMove(ctx, emptyCells[rngRange(&ctx->rng, emptyCount)], start);
+        ctx->maxDepth = 4 + rngRange(&ctx->rng, 2); // maxDepth 4–5 and imperfectChance 20%
     }
 
-    // Evaluate all possible moves
-    int bestVal = -INF, bestCount = 0;
-    Move bestMoves[9];
+    // Evaluate all possible moves. With ordering the root also goes center, corners, edges, so the likely
+    // best move sets the bound early; plain search keeps row-major order
+    Bitboard board; // only built once we know there is a search to do
+    loadBoard(&board, marks[BB_X], marks[BB_O]);
+    int rootMoves[9], rootCount = 0;
+    const unsigned short rowMajor[1] = { FULL_MASK };
+    const unsigned short *groups = ctx->ordering ? orderGroups : rowMajor;
+    for (int g = 0; g < (ctx->ordering ? 3 : 1); g++)
+        for (unsigned short m = emptyMask(&board) & groups[g]; m; m &= m - 1)
+            rootMoves[rootCount++] = lowestBit(m);
+
+    // Iterative deepening up to the difficulty's depth, within the node and time budget. Only a finished
+    // iteration counts: when the budget runs out the previous one answers, or the first root move if none did
+    ctx->nodeBudget = ctx->nodeLimit ? ctx->nodeLimit : searchNodeBudget(difficulty);
+    ctx->deadlineNs = start + 1000000ULL * (ctx->timeLimitMs ? ctx->timeLimitMs : searchTimeBudgetMs(difficulty));
+    ctx->halted = 0;
+    int targetDepth = ctx->maxDepth;
+    MinimaxKernel search = rootKernels[difficulty];
+    unsigned short bestSet = 1u << rootMoves[0]; // every move scoring bestVal in the last finished iteration
+    for (int depth = 1; depth <= targetDepth && !ctx->halted; depth++) {
+        ctx->maxDepth = depth;
+        ctx->horizonHit = 0;
+        int bestVal = -INF, rootScores[9];
+        unsigned short iterationSet = 0;
 
-    for (int i = 0; i < SIZE; i++) { // for every empty position place AI mark.
-        for (int j = 0; j < SIZE; j++) {
-            if (CELL(board, i, j) != ' ') continue;
+        for (int k = 0; k < rootCount; k++) { // for every empty position place AI mark.
+            int idx = rootMoves[k];
 
-            CELL(board, i, j) = player;
-            int moveVal = minimax(board, 0, 0, -INF, INF, maxDepth, &recurses, &depthCount); // call minimax to evaluate position
-            CELL(board, i, j) = ' '; // undo move
+            toggleCell(&board, side, idx);
+            int moveVal;
+            if (!ctx->pvs || k == 0) {
+                moveVal = search(ctx, &board, 0, -INF, INF); // call minimax to evaluate position
+            } else {
+                // Ties matter here (one is picked at random), so probe around bestVal instead of above it
+                moveVal = search(ctx, &board, 0, bestVal - 1, bestVal + 1);
+                if (moveVal > bestVal) moveVal = search(ctx, &board, 0, bestVal, INF);
+            }
+            toggleCell(&board, side, idx); // undo move
+            if (ctx->halted) break;
+            rootScores[k] = moveVal;
 
             if (moveVal > bestVal) {
                 bestVal = moveVal;
-                bestCount = 0;
-                bestMoves[bestCount++] = (Move){i, j}; // update list of best moves
-            } else if (moveVal == bestVal) { // Also update if current move is as good as best move
-                bestMoves[bestCount++] = (Move){i, j};
+                iterationSet = 0; // update list of best moves
             }
+            if (moveVal == bestVal) iterationSet |= (unsigned short)(1u << idx); // Also update if current move is as good as best move
         }
-    }
+        if (ctx->halted) break;
+        bestSet = iterationSet;
+        if (!ctx->horizonHit) break; // every line reached the end of the game: deeper would find the same
 
-    Move bestMove = bestMoves[rand() % bestCount]; // choose randomly among the best moves
+        // The next iteration starts with this one's best line: root moves by score, ties keep their order.
+        // Below the root the table moves stored by this iteration lead the way
+        if (ctx->ordering) {
+            for (int k = 1; k < rootCount; k++) {
+                int move = rootMoves[k], score = rootScores[k], at = k;
+                for (; at > 0 && rootScores[at - 1] < score; at--) {
+                    rootMoves[at] = rootMoves[at - 1];
+                    rootScores[at] = rootScores[at - 1];
+                }
+                rootMoves[at] = move;
+                rootScores[at] = score;
+            }
+        }
+    }
+    ctx->maxDepth = targetDepth;
 
-    printf("\nAI (Level %d) chose (%d,%d)\n", difficulty, bestMove.row, bestMove.col);
-    printStatistics(start, freq, depthCount, recurses);
-    return bestMove;
+    // choose randomly among the best moves, counted in row-major order whatever order they were searched in
+    for (int n = rngRange(&ctx->rng, popCount(bestSet)); n > 0; n--) bestSet &= bestSet - 1;
+    int cell = lowestBit(bestSet);
+    Move bestMove = {cell / SIZE, cell % SIZE};
+    return finishMove(ctx, bestMove, start);
 }
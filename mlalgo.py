@@ -8,7 +8,16 @@ import numpy as np
 import random
 import tracemalloc
 import time
+import struct
 import sys
+import os
+
+MODEL_FILE = os.environ.get("TTT_NB_MODEL", "tic-tac-toe.nbm")   # swap models without touching the game
+MODEL_MAGIC = b"TTNB"
+MODEL_VERSION = 1
+MAX_CLASSES = 4                             # fixed-size layout shared with NaiveBayesModel in naive_bayes.h
+MODEL_HEADER = struct.Struct("<4s5i")       # magic, version, features, states, class count, negative class index
+MODEL_SIZE = MODEL_HEADER.size + MAX_CLASSES * 16 + MAX_CLASSES * 8 + 9 * MAX_CLASSES * 3 * 8
 
 def load_data(file):
     boards = []
@@ -31,33 +40,91 @@ def load_data(file):
 
     return df, y
 
-def predict(board, model, encoder):
-    tracemalloc.start()                       # start tracking memory allocations
+def encode_candidates(board, encoder):
+    codes = {c: i for i, c in enumerate(encoder.categories_[0])}       # B -> 0, O -> 1, X -> 2, same as the encoder
+    encoded = np.array([codes[c] for c in board], dtype=int)
+    moves = np.flatnonzero(encoded == codes["B"])                          # every empty spot is a candidate move
+    boards = np.repeat(encoded[None, :], len(moves), axis=0)               # one row per candidate board
+    boards[np.arange(len(moves)), moves] = codes["O"]                      # simulate the AI move in each row
+    return moves, boards
+
+def predict(board, model, encoder, trace=False):
+    if trace:
+        tracemalloc.start()                   # memory tracking is opt-in, it slows every allocation down
     start_time = time.perf_counter()          # start the timer
-    move = None
-    best = -1
 
-    for i in range(9):                      # loop through to find 'B' spots in the board
-        if board[i] != "B":                 # skip if current spot is not 'B'
-            continue
+    moves, boards = encode_candidates(board, encoder)                      # all candidate boards as one numpy array
+    negative = list(model.classes_).index("NEGATIVE")
+    probs = model.predict_proba(boards)[:, negative]                       # score every candidate in one call
+    move = int(moves[np.argmax(probs)]) if len(moves) else None            # first best, like the old strict > loop
 
-        new_board = board.copy()            # make a copy of the board
-        new_board[i] = "O"                  # replace current spot with 'O' to simulate AI move
+    end_time = time.perf_counter()            # end the timer
+    current_mem = peak_mem = 0
+    if trace:
+        current_mem, peak_mem = tracemalloc.get_traced_memory()   # get the current and peak memory usage
+        tracemalloc.stop()                  # stop tracking memory allocations
 
-        new_board_df = pd.DataFrame([new_board], columns=[f"cell{j}" for j in range(9)])    # convert to pandas dataframe using list comprehension to get board as 1 row of data
-        new_board_encoded = encoder.transform(new_board_df)     # encode the new board to 0, 1 and 2s
+    return move, current_mem, peak_mem, round(end_time-start_time, 6)     # return the best move along with current, peak memory usage and time taken
 
-        prob = model.predict_proba(new_board_encoded)[0][list(model.classes_).index("NEGATIVE")]    # give a probability of the board being negative outcome based on the current 'O' spot on the board
+class MappedNB:
+    """Fitted CategoricalNB tables read straight from a model file, no parsing or refitting."""
+
+    def __init__(self, path):
+        self.data = np.memmap(path, dtype=np.uint8, mode="r")               # memory-map the whole file
+        if len(self.data) != MODEL_SIZE:
+            raise ValueError(f"{path} is not a Naive Bayes model file")
+        magic, version, features, states, n_classes, negative = MODEL_HEADER.unpack_from(self.data)
+        if magic != MODEL_MAGIC or version != MODEL_VERSION or features != 9 or states != 3:
+            raise ValueError(f"{path} is not a version {MODEL_VERSION} Naive Bayes model")
+
+        offset = MODEL_HEADER.size
+        names = bytes(self.data[offset:offset + MAX_CLASSES * 16])
+        self.classes_ = np.array([names[i*16:(i+1)*16].split(b"\0")[0].decode() for i in range(n_classes)])
+        offset += MAX_CLASSES * 16
+        self.class_log_prior_ = np.frombuffer(self.data, dtype="<f8", count=n_classes, offset=offset)
+        offset += MAX_CLASSES * 8
+        tables = np.frombuffer(self.data, dtype="<f8", count=9 * MAX_CLASSES * 3, offset=offset).reshape(9, MAX_CLASSES, 3)
+        self.feature_log_prob_ = [tables[i, :n_classes, :] for i in range(9)]  # same shape as sklearn's attribute
+
+    def predict_proba(self, X):
+        X = np.asarray(X, dtype=int)
+        jll = self.class_log_prior_ + sum(self.feature_log_prob_[i][:, X[:, i]].T for i in range(9))
+        jll -= jll.max(axis=1, keepdims=True)                                 # log-sum-exp normalisation
+        proba = np.exp(jll)
+        return proba / proba.sum(axis=1, keepdims=True)
+
+
+def export_model(model, path=MODEL_FILE):
+    classes = [str(c) for c in model.classes_]
+    tables = np.zeros((9, MAX_CLASSES, 3))
+    for i in range(9):
+        tables[i, :len(classes), :model.feature_log_prob_[i].shape[1]] = model.feature_log_prob_[i]
+    priors = np.zeros(MAX_CLASSES)
+    priors[:len(classes)] = model.class_log_prior_
+
+    with open(path, "wb") as f:
+        f.write(MODEL_HEADER.pack(MODEL_MAGIC, MODEL_VERSION, 9, 3, len(classes), classes.index("NEGATIVE")))
+        f.write(b"".join(name.encode().ljust(16, b"\0") for name in classes + [""] * (MAX_CLASSES - len(classes))))
+        f.write(priors.astype("<f8").tobytes())
+        f.write(tables.astype("<f8").tobytes())
+
+
+def train(file="tic-tac-toe.data"):
+    df, y = load_data(file)                  # load the data from the given data file
+    encoder = OrdinalEncoder(categories=[["B","O","X"]] * 9, dtype=int)         # encoder to force transform B -> 0, O -> 1, X -> 2
+    X_encoded = encoder.fit_transform(df)   # convert the dataframe into numbers
 
-        if prob > best:                              # if the probability is more than current best
-            best = prob                              # replace the current best probability to the new one
-            move = i                                 # replace move to the current move
-    
-    end_time = time.perf_counter()            # end the timer
-    current_mem, peak_mem = tracemalloc.get_traced_memory()   # get the current and peak memory usage
-    tracemalloc.stop()                      # stop tracking memory allocations
+    model = CategoricalNB()
+    model.fit(X_encoded, y)                 # train the model using the encoded data and results from the data file
+    return model, encoder
 
-    return move, current_mem, peak_mem, round(end_time-start_time, 6)     # return the best move along with current, peak memory usage and time taken
+
+def load_model(path=MODEL_FILE):
+    encoder = OrdinalEncoder(categories=[["B","O","X"]] * 9, dtype=int)         # fixed categories, so fitting on one row is enough
+    encoder.fit(pd.DataFrame([["B"] * 9], columns=[f"cell{i}" for i in range(9)]))
+    if os.path.exists(path):
+        return MappedNB(path), encoder       # compiled model: startup cost does not depend on the dataset size
+    return train()                          # no model file yet, fit from the raw data
 
 def decode_board(board_str):
     board = [c.strip().upper() if c.strip() != "" else "B" for c in board_str.split(",")]   # list comprehension to empty spaces and uppercase it after splitting based on ',', then 'B' if empty
@@ -104,11 +171,11 @@ def evaluate():
 
     win_rate(model, encoder)                         # evaluate the win rate of the model
 
-def win_rate(model, encoder):
+def win_rate(model, encoder, games=100):
 
     results = {"Win":0, "Loss":0, "Draw":0}
 
-    for game in range(100):           # Simulate 100 games
+    for game in range(games):         # Simulate the games
         board = ["B"] * 9             # Start with an empty board
         results[play(board, model, encoder)] += 1
     
@@ -129,7 +196,7 @@ def play(board, model, encoder):
             if all(board[i] != "B" for i in range(9)):                          # Board is full
                 return "Draw"                                                   # Game is a Draw             
 
-        o_move = predict(board.copy(), model, encoder)                          # AI move for O
+        o_move = predict(board, model, encoder)[0]                              # AI move for O, batched scoring
         board[o_move] = "O"                 
         for win in wins:                    
             if all(board[i] == "O" for i in win):                               # O wins
@@ -137,21 +204,19 @@ def play(board, model, encoder):
             if all(board[i] != "B" for i in range(9)):                          # Board is full
                 return "Draw"                                                   # Game is a Draw
 
-def main(board_str):
+def main(board_str, trace=False):
 
     board = decode_board(board_str)         # decode the board given from the C code
-    df, y = load_data("tic-tac-toe.data")   # load the data from the given data file
-
-    encoder = OrdinalEncoder(categories=[["B","O","X"]] * 9, dtype=int)         # encoder to force transform B -> 0, O -> 1, X -> 2
-    X_encoded = encoder.fit_transform(df)   # convert the dataframe into numbers
-
-    model = CategoricalNB()                 
-    model.fit(X_encoded, y)                 # train the model using the encoded data and results from the data file
-    return predict(board, model, encoder)   # returns the prediction based on the train model, encoder and the given board, as well as the memory usage
+    model, encoder = load_model()           # memory-mapped model file, or a fresh fit if there is none
+    return predict(board, model, encoder, trace)   # returns the prediction based on the train model, encoder and the given board, as well as the memory usage
 
 if __name__ == "__main__":
-    move, current_mem, peak_mem, time_taken = main(sys.argv[1])
-    print(f"{move} {current_mem} {peak_mem} {time_taken}")
+    if sys.argv[1] == "--export":                                               # python mlalgo.py --export [model file]
+        model, _ = train()
+        export_model(model, sys.argv[2] if len(sys.argv) > 2 else MODEL_FILE)
+    else:                                                                       # python mlalgo.py <board> [--trace]
+        move, current_mem, peak_mem, time_taken = main(sys.argv[1], "--trace" in sys.argv[2:])
+        print(f"{move} {current_mem} {peak_mem} {time_taken}")
 
 
 # evaluate() # Uncomment to run evaluation of the model
\ No newline at end of file
@@ -0,0 +1,442 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "mnk.h"
+#include "rng.h"
+#include "threadpool.h"
+
+#define MNK_X 0
+#define MNK_O 1
+#define WIN_SCORE 1000000000 // minus the ply it happens at, so faster wins score higher
+#define INF (WIN_SCORE + 1000)
+#define LIMIT_CHECK_NODES 1024 // each thread looks at the clock and the node budget this often
+
+// Shared by every thread of one search: when to give up
+typedef struct {
+    atomic_int halted;             // set once any limit is hit, every thread then unwinds
+    atomic_int *stop;              // caller's cancel flag, may be NULL
+    atomic_long nodes;             // nodes reported so far by all threads
+    long nodeLimit;                // 0 = none
+    unsigned long long deadlineNs; // metricsNowNs() value, 0 = none
+} MnkLimits;
+
+typedef struct {
+    const MnkRules *rules;
+    MnkBits bits[2]; // bits[MNK_X] and bits[MNK_O]
+    long nodes;
+    long cutoffs;
+    int maxPly;
+    MnkLimits *limits;
+    long reported; // part of nodes already added to limits->nodes
+    // Evaluation state, set up by startSearch() and kept current by placeMark()/takeBack()
+    int empty;                              // empty cells
+    int lineEval;                           // evaluate() for X
+    unsigned char marks[2][MNK_MAX_LINES];  // marks of each side in every window
+} MnkSearch;
+
+// Heuristic value of a window holding n marks of one side and none of the other
+static const int lineScore[MNK_MAX_DIM + 1] = {0, 1, 8, 64, 512, 4096, 32768, 262144, 2097152};
+
+// Open windows only: a window with both marks in it can never be completed. For X, so O's windows count negative
+static inline int windowValue(int x, int o) {
+    return (o == 0) ? lineScore[x] : (x == 0) ? -lineScore[o] : 0;
+}
+
+static inline int popCount(MnkBits m) { return __builtin_popcountll(m); }
+static inline int lowestBit(MnkBits m) { return __builtin_ctzll(m); }
+static inline int stopped(const MnkSearch *s) {
+    return atomic_load_explicit(&s->limits->halted, memory_order_relaxed);
+}
+
+// Add this thread's new nodes to the shared count and halt the search if a limit has been reached
+static void checkLimits(MnkSearch *s) {
+    MnkLimits *l = s->limits;
+    long total = atomic_fetch_add(&l->nodes, s->nodes - s->reported) + (s->nodes - s->reported);
+    s->reported = s->nodes;
+    if ((l->stop && atomic_load(l->stop)) || (l->nodeLimit && total >= l->nodeLimit) ||
+        (l->deadlineNs && metricsNowNs() >= l->deadlineNs))
+        atomic_store(&l->halted, 1);
+}
+
+// Add one window to the line table and to the lists of every cell it covers
+static void addLine(MnkRules *r, int row, int col, int dRow, int dCol) {
+    MnkBits line = 0;
+    for (int i = 0; i < r->k; i++)
+        line |= 1ULL << ((row + i * dRow) * r->width + (col + i * dCol));
+    for (MnkBits m = line; m; m &= m - 1) {
+        int cell = lowestBit(m);
+        r->cellLines[cell][r->cellLineCount[cell]++] = (unsigned short)r->lineCount;
+    }
+    r->lines[r->lineCount++] = line;
+}
+
+void mnkInitRules(MnkRules *r, int width, int height, int k) {
+    memset(r, 0, sizeof(*r));
+    r->width = width;
+    r->height = height;
+    r->k = k;
+    r->cells = width * height;
+
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            if (col + k <= width) addLine(r, row, col, 0, 1);                      // horizontal
+            if (row + k <= height) addLine(r, row, col, 1, 0);                     // vertical
+            if (row + k <= height && col + k <= width) addLine(r, row, col, 1, 1); // diagonal
+            if (row + k <= height && col - k + 1 >= 0) addLine(r, row, col, 1, -1); // anti-diagonal
+        }
+    }
+
+    // Cells in many windows first (the center on an empty board), ties by index
+    for (int i = 0; i < r->cells; i++) r->order[i] = (unsigned char)i;
+    for (int i = 1; i < r->cells; i++) {
+        unsigned char cell = r->order[i];
+        int j = i;
+        while (j > 0 && r->cellLineCount[r->order[j - 1]] < r->cellLineCount[cell]) {
+            r->order[j] = r->order[j - 1];
+            j--;
+        }
+        r->order[j] = cell;
+    }
+
+    r->fullMask = (r->cells == 64) ? ~0ULL : (1ULL << r->cells) - 1;
+    for (int i = 0; i < r->cells; i++) {
+        if (i % width != 0) r->notLeftCol |= 1ULL << i;
+        if (i % width != width - 1) r->notRightCol |= 1ULL << i;
+    }
+}
+
+static void loadBoard(const MnkRules *r, const char *board, MnkBits bits[2]) {
+    bits[MNK_X] = bits[MNK_O] = 0;
+    for (int i = 0; i < r->cells; i++) {
+        if (board[i] == 'X') bits[MNK_X] |= 1ULL << i;
+        else if (board[i] == 'O') bits[MNK_O] |= 1ULL << i;
+    }
+}
+
+// Position, limits and the evaluation state counted from scratch; counters start at zero
+static void startSearch(MnkSearch *s, const MnkRules *r, const MnkBits bits[2], MnkLimits *limits) {
+    s->rules = r;
+    s->bits[MNK_X] = bits[MNK_X];
+    s->bits[MNK_O] = bits[MNK_O];
+    s->nodes = s->cutoffs = s->reported = 0;
+    s->maxPly = 0;
+    s->limits = limits;
+    s->empty = r->cells - popCount(bits[MNK_X] | bits[MNK_O]);
+    s->lineEval = 0;
+    for (int i = 0; i < r->lineCount; i++) {
+        s->marks[MNK_X][i] = (unsigned char)popCount(bits[MNK_X] & r->lines[i]);
+        s->marks[MNK_O][i] = (unsigned char)popCount(bits[MNK_O] & r->lines[i]);
+        s->lineEval += windowValue(s->marks[MNK_X][i], s->marks[MNK_O][i]);
+    }
+}
+
+// Make a move, updating only the windows through the cell. Returns 1 if it completed one (a win)
+static inline int placeMark(MnkSearch *s, int side, int cell) {
+    const MnkRules *r = s->rules;
+    int won = 0;
+    s->bits[side] |= 1ULL << cell;
+    s->empty--;
+    for (int i = 0; i < r->cellLineCount[cell]; i++) {
+        int line = r->cellLines[cell][i];
+        int before = windowValue(s->marks[MNK_X][line], s->marks[MNK_O][line]);
+        won |= (++s->marks[side][line] == r->k);
+        s->lineEval += windowValue(s->marks[MNK_X][line], s->marks[MNK_O][line]) - before;
+    }
+    return won;
+}
+
+static inline void takeBack(MnkSearch *s, int side, int cell) {
+    const MnkRules *r = s->rules;
+    s->bits[side] &= ~(1ULL << cell);
+    s->empty++;
+    for (int i = 0; i < r->cellLineCount[cell]; i++) {
+        int line = r->cellLines[cell][i];
+        int before = windowValue(s->marks[MNK_X][line], s->marks[MNK_O][line]);
+        s->marks[side][line]--;
+        s->lineEval += windowValue(s->marks[MNK_X][line], s->marks[MNK_O][line]) - before;
+    }
+}
+
+char mnkWinner(const MnkRules *r, const char *board) {
+    MnkBits bits[2];
+    loadBoard(r, board, bits);
+    for (int i = 0; i < r->lineCount; i++) {
+        if ((bits[MNK_X] & r->lines[i]) == r->lines[i]) return 'X';
+        if ((bits[MNK_O] & r->lines[i]) == r->lines[i]) return 'O';
+    }
+    return 0;
+}
+
+// Sum of windowValue over every window, for the side to move. Kept incrementally, so this is a read
+static inline int evaluate(const MnkSearch *s, int side) {
+    return (side == MNK_X) ? s->lineEval : -s->lineEval;
+}
+
+// Empty cells next to a mark. Small boards (and an empty board) consider every empty cell
+MnkBits mnkCandidateMoves(const MnkRules *r, const MnkBits bits[2]) {
+    MnkBits occupied = bits[MNK_X] | bits[MNK_O];
+    MnkBits empty = ~occupied & r->fullMask;
+    if (r->cells <= 16 || occupied == 0) return empty;
+
+    MnkBits h = occupied | ((occupied << 1) & r->notLeftCol) | ((occupied >> 1) & r->notRightCol);
+    MnkBits near = h | (h << r->width) | (h >> r->width);
+    return near & empty;
+}
+
+// Depth-limited negamax with alpha-beta pruning. Scores are for the side to move
+static int negamax(MnkSearch *s, int side, int depth, int ply, int alpha, int beta) {
+    const MnkRules *r = s->rules;
+    if (++s->nodes % LIMIT_CHECK_NODES == 0) checkLimits(s);
+    if (ply > s->maxPly) s->maxPly = ply;
+
+    if (s->empty == 0) return 0; // draw
+    if (depth == 0) return evaluate(s, side);
+    if (stopped(s)) return 0; // the caller throws this iteration away
+
+    MnkBits moves = mnkCandidateMoves(r, s->bits);
+    int best = -INF;
+    for (int i = 0; i < r->cells && moves; i++) {
+        int cell = r->order[i];
+        MnkBits bit = 1ULL << cell;
+        if (!(moves & bit)) continue;
+        moves &= ~bit;
+
+        int val = placeMark(s, side, cell) ? WIN_SCORE - (ply + 1)
+                                           : -negamax(s, !side, depth - 1, ply + 1, -beta, -alpha);
+        takeBack(s, side, cell);
+
+        if (val > best) best = val;
+        if (best > alpha) alpha = best;
+        if (alpha >= beta) { s->cutoffs++; break; } // prune
+    }
+    return best;
+}
+
+// Search depth per difficulty. Boards up to 3x3 are small enough to solve outright on Hard
+static int depthFor(const MnkRules *r, int difficulty) {
+    if (difficulty == 1) return 2;
+    if (difficulty == 2) return 4;
+    if (r->cells <= 9) return r->cells;
+    return (r->cells <= 25) ? 8 : 6;
+}
+
+// One root iteration, one move after another. The window starts one below the best score so far,
+// so moves that tie with the best still get exact scores while worse moves are cut off early
+static void searchRootSerial(MnkSearch *s, const int *rootMoves, int *rootScores, int rootCount, int depth) {
+    int bestVal = -INF;
+    for (int i = 0; i < rootCount; i++) {
+        int cell = rootMoves[i];
+        int val = placeMark(s, MNK_O, cell) ? WIN_SCORE - 1 : -negamax(s, MNK_X, depth - 1, 1, -INF, -(bestVal - 1));
+        takeBack(s, MNK_O, cell);
+        rootScores[i] = val;
+        if (val > bestVal) bestVal = val;
+    }
+}
+
+// ---------------- Parallel search ----------------
+// Root moves are tasks in the work-stealing pool. Each root task is also a split point: after its first
+// reply has been searched (young brothers wait) the remaining replies become tasks other threads can steal.
+// The best root score is shared, so every task narrows its window as soon as any thread finds a better move.
+typedef struct {
+    const MnkRules *rules;
+    MnkBits bits[2];      // root position
+    int depth;
+    MnkLimits *limits;
+    atomic_int rootBest;  // best exact root score found so far
+    atomic_long nodes;
+    atomic_long cutoffs;
+    atomic_int maxPly;
+} ParallelRoot;
+
+typedef struct RootJob RootJob;
+
+typedef struct {
+    RootJob *parent;
+    int cell;
+} ReplyJob;
+
+struct RootJob {
+    ParallelRoot *root;
+    int cell;
+    int score;
+    atomic_int replyBest;  // best score for the opponent over the replies searched so far
+    TaskGroup replies;
+    ReplyJob replyJobs[MNK_MAX_CELLS];
+};
+
+static void atomicMax(atomic_int *target, int value) {
+    int current = atomic_load(target);
+    while (value > current && !atomic_compare_exchange_weak(target, &current, value)) {}
+}
+
+static void finishTask(ParallelRoot *root, MnkSearch *s) {
+    checkLimits(s);
+    atomic_fetch_add(&root->nodes, s->nodes);
+    atomic_fetch_add(&root->cutoffs, s->cutoffs);
+    atomicMax(&root->maxPly, s->maxPly);
+}
+
+// Search one reply of the opponent (ply 1) below root move job->cell
+static void replyTask(void *arg) {
+    ReplyJob *reply = arg;
+    RootJob *job = reply->parent;
+    ParallelRoot *root = job->root;
+
+    // Opponent window: alpha from the replies so far, beta from the shared root best (root alpha = best - 1)
+    int alpha = atomic_load(&job->replyBest);
+    int beta = 1 - atomic_load(&root->rootBest);
+    if (alpha >= beta) return; // a sibling already refuted this root move
+
+    MnkSearch s;
+    startSearch(&s, root->rules, root->bits, root->limits);
+    placeMark(&s, MNK_O, job->cell);
+    int val = placeMark(&s, MNK_X, reply->cell) ? WIN_SCORE - 2 : -negamax(&s, MNK_O, root->depth - 2, 2, -beta, -alpha);
+    atomicMax(&job->replyBest, val);
+    finishTask(root, &s);
+}
+
+static void rootTask(void *arg) {
+    RootJob *job = arg;
+    ParallelRoot *root = job->root;
+    const MnkRules *r = root->rules;
+    MnkSearch s;
+    startSearch(&s, r, root->bits, root->limits);
+
+    if (placeMark(&s, MNK_O, job->cell)) {
+        job->score = WIN_SCORE - 1;
+    } else if (root->depth < 2 || s.empty == 0) {
+        job->score = -negamax(&s, MNK_X, root->depth - 1, 1, -INF, -(atomic_load(&root->rootBest) - 1));
+    } else {
+        // Split point: count this node, search the first reply here, then hand out the rest
+        s.nodes++;
+        MnkBits moves = mnkCandidateMoves(r, s.bits);
+        int replyCount = 0;
+        for (int i = 0; i < r->cells; i++)
+            if (moves & (1ULL << r->order[i]))
+                job->replyJobs[replyCount++] = (ReplyJob){ job, r->order[i] };
+
+        atomic_init(&job->replyBest, -INF);
+        taskGroupInit(&job->replies);
+        replyTask(&job->replyJobs[0]);
+        for (int i = 1; i < replyCount; i++)
+            poolSpawn(&job->replies, replyTask, &job->replyJobs[i]);
+        poolWait(&job->replies);
+        job->score = -atomic_load(&job->replyBest);
+    }
+    atomicMax(&root->rootBest, job->score);
+    finishTask(root, &s);
+}
+
+static void searchRootParallel(MnkSearch *s, const int *rootMoves, int *rootScores, int rootCount, int depth) {
+    ParallelRoot root;
+    root.rules = s->rules;
+    root.bits[MNK_X] = s->bits[MNK_X];
+    root.bits[MNK_O] = s->bits[MNK_O];
+    root.depth = depth;
+    root.limits = s->limits;
+    atomic_init(&root.rootBest, -INF);
+    atomic_init(&root.nodes, 0);
+    atomic_init(&root.cutoffs, 0);
+    atomic_init(&root.maxPly, s->maxPly);
+
+    RootJob *jobs = malloc(sizeof(RootJob) * rootCount);
+    TaskGroup group;
+    taskGroupInit(&group);
+    for (int i = 0; i < rootCount; i++) {
+        jobs[i].root = &root;
+        jobs[i].cell = rootMoves[i];
+        poolSpawn(&group, rootTask, &jobs[i]);
+    }
+    poolWait(&group);
+
+    for (int i = 0; i < rootCount; i++) rootScores[i] = jobs[i].score;
+    s->nodes += atomic_load(&root.nodes);
+    s->cutoffs += atomic_load(&root.cutoffs);
+    s->maxPly = atomic_load(&root.maxPly);
+    free(jobs);
+}
+
+// Hand the counters back to the caller, if it asked for them
+static Move finishMove(const MnkSearch *s, int cell, SearchStats *stats, unsigned long long start) {
+    if (stats) {
+        memset(stats, 0, sizeof(*stats));
+        stats->nodes = s->nodes;
+        stats->cutoffs = s->cutoffs;
+        stats->maxDepth = s->maxPly;
+        metricsFinish(stats, start);
+    }
+    if (cell < 0) return (Move){-1, -1};
+    return (Move){cell / s->rules->width, cell % s->rules->width};
+}
+
+// Iterative deepening over the root moves. Each iteration re-orders the moves by the previous scores
+Move mnkFindBestMove(const MnkRules *r, const char *board, int difficulty, const MnkOptions *options, SearchStats *stats) {
+    unsigned long long start = metricsNowNs();
+    MnkLimits limits = { 0, options ? options->stop : NULL, 0, options ? options->nodeLimit : 0, 0 };
+    if (options && options->timeLimitMs) limits.deadlineNs = start + options->timeLimitMs * 1000000ULL;
+    MnkBits bits[2];
+    loadBoard(r, board, bits);
+    MnkSearch s;
+    startSearch(&s, r, bits, &limits);
+    MnkBits empty = ~(s.bits[MNK_X] | s.bits[MNK_O]) & r->fullMask;
+    if (!empty) return finishMove(&s, -1, stats, start); // full board: nothing to play
+
+    // Every random choice comes from this generator, so a fixed seed gives a fixed move
+    Rng rng;
+    rngSeed(&rng, options ? options->seed : 0);
+    int parallel = options && options->parallel;
+    if (parallel) poolInit(0);
+
+    int rootMoves[MNK_MAX_CELLS], rootScores[MNK_MAX_CELLS], rootCount = 0;
+    MnkBits candidates = mnkCandidateMoves(r, s.bits);
+    for (int i = 0; i < r->cells; i++)
+        if (candidates & (1ULL << r->order[i]))
+            rootMoves[rootCount++] = r->order[i];
+
+    // Same imperfection as the 3x3 engine: Easy is 70% random, Medium 20%
+    if ((difficulty == 1 && rngRange(&rng, 100) < 70) || (difficulty == 2 && rngRange(&rng, 100) < 20)) {
+        MnkBits m = empty;
+        for (int n = rngRange(&rng, popCount(empty)); n > 0; n--) m &= m - 1;
+        return finishMove(&s, lowestBit(m), stats, start);
+    }
+
+    int maxDepth = (options && options->maxDepth) ? options->maxDepth : depthFor(r, difficulty);
+    int bestVal = -INF, completed = 0;
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        int savedScores[MNK_MAX_CELLS];
+        memcpy(savedScores, rootScores, sizeof(int) * rootCount);
+        if (parallel) searchRootParallel(&s, rootMoves, rootScores, rootCount, depth);
+        else searchRootSerial(&s, rootMoves, rootScores, rootCount, depth);
+        if (stopped(&s)) { // unfinished iteration: keep the scores of the last complete one
+            memcpy(rootScores, savedScores, sizeof(int) * rootCount);
+            break;
+        }
+        completed = 1;
+
+        // Stable insertion sort by score, so the next iteration searches the best moves first
+        for (int i = 1; i < rootCount; i++) {
+            int cell = rootMoves[i], score = rootScores[i], j = i;
+            while (j > 0 && rootScores[j - 1] < score) {
+                rootMoves[j] = rootMoves[j - 1];
+                rootScores[j] = rootScores[j - 1];
+                j--;
+            }
+            rootMoves[j] = cell;
+            rootScores[j] = score;
+        }
+        bestVal = rootScores[0];
+        if (bestVal >= WIN_SCORE - depth || bestVal <= -WIN_SCORE + depth) break; // result is forced
+    }
+
+    if (!completed) return finishMove(&s, rootMoves[0], stats, start); // stopped before depth 1 finished
+
+    // Only the moves tying with the best have exact scores. Pick among them in cell order, so serial and
+    // parallel searches (whose other scores are timing-dependent bounds) choose the same move for a seed
+    int bestMoves[MNK_MAX_CELLS], bestCount = 0;
+    for (int i = 0; i < r->cells; i++)
+        for (int j = 0; j < rootCount && rootScores[j] == bestVal; j++)
+            if (rootMoves[j] == i) bestMoves[bestCount++] = i;
+
+    int cell = bestMoves[rngRange(&rng, bestCount)]; // choose randomly among the best moves
+    return finishMove(&s, cell, stats, start);
+}
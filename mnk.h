@@ -0,0 +1,45 @@
+#ifndef MNK_H
+#define MNK_H
+
+#include <stdatomic.h>
+#include "minimax.h"
+
+// Generalised m,n,k engine: width x height board, k in a row wins. Used for every board other than 3x3
+#define MNK_MAX_DIM 8
+#define MNK_MAX_CELLS (MNK_MAX_DIM * MNK_MAX_DIM)
+#define MNK_MAX_LINES (4 * MNK_MAX_CELLS)
+#define MNK_MAX_CELL_LINES (4 * MNK_MAX_DIM) // at most k windows per direction go through one cell
+
+typedef unsigned long long MnkBits; // bit (row * width + col)
+
+// Board rules plus the line tables derived from them. Build once with mnkInitRules()
+typedef struct {
+    int width, height, k, cells;
+    int lineCount;
+    MnkBits lines[MNK_MAX_LINES];   // every k-long window: rows, columns, both diagonals
+    unsigned char cellLineCount[MNK_MAX_CELLS];
+    unsigned short cellLines[MNK_MAX_CELLS][MNK_MAX_CELL_LINES]; // windows going through each cell
+    unsigned char order[MNK_MAX_CELLS]; // cells sorted by how many windows go through them, most first
+    MnkBits fullMask, notLeftCol, notRightCol;
+} MnkRules;
+
+// Search settings. Passing NULL searches on the calling thread with seed 0 and no limits
+typedef struct {
+    int parallel;            // spread the search over the work-stealing pool (one worker per core)
+    unsigned long long seed; // every random choice comes from this seed: same seed, same move
+    atomic_int *stop;        // optional: once non-zero the search gives up and returns its best move so far
+    // Optional limits, 0 = none. Like the stop flag they end the search early with the deepest finished iteration
+    long nodeLimit;
+    unsigned long timeLimitMs;
+    int maxDepth;            // overrides the depth that comes with the difficulty
+} MnkOptions;
+
+void mnkInitRules(MnkRules *rules, int width, int height, int k);
+
+// board is row-major, width * height chars of 'X', 'O' or ' '
+char mnkWinner(const MnkRules *rules, const char *board); // 'X', 'O' or 0
+MnkBits mnkCandidateMoves(const MnkRules *rules, const MnkBits bits[2]); // moves worth searching: X's bits, O's bits
+Move mnkFindBestMove(const MnkRules *rules, const char *board, int difficulty, const MnkOptions *options,
+                     SearchStats *stats); // AI plays 'O', {-1, -1} on a full board. stats may be NULL
+
+#endif
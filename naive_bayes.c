@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#ifdef _WIN32
+#include <windows.h> // before minimax.h: windows.h has its own SIZE type
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include "naive_bayes.h"
+
+#define NB_ALPHA 1.0 // Laplace smoothing, sklearn's default
+
+static int stateOf(char c) {
+    c = (char)toupper((unsigned char)c);
+    return c == 'O' ? 1 : c == 'X' ? 2 : 0; // 'B' and ' ' are blank
+}
+
+// Index of the class name, adding it (kept sorted) if it is new. -1 when there are too many classes
+static int classIndex(NaiveBayesModel *model, const char *name, double counts[][NB_FEATURES][NB_STATES], double *classCounts) {
+    int i = 0;
+    while (i < model->classCount && strcmp(model->classNames[i], name) < 0) i++;
+    if (i < model->classCount && strcmp(model->classNames[i], name) == 0) return i;
+    if (model->classCount == NB_MAX_CLASSES) return -1;
+
+    // Shift the later classes up to keep the names sorted
+    for (int j = model->classCount; j > i; j--) {
+        strcpy(model->classNames[j], model->classNames[j - 1]);
+        memcpy(counts[j], counts[j - 1], sizeof(counts[0]));
+        classCounts[j] = classCounts[j - 1];
+    }
+    snprintf(model->classNames[i], sizeof(model->classNames[i]), "%s", name);
+    memset(counts[i], 0, sizeof(counts[0]));
+    classCounts[i] = 0;
+    model->classCount++;
+    return i;
+}
+
+// Read tic-tac-toe.data (9 cells then the outcome per line) and fit the model
+int nbTrain(NaiveBayesModel *model, const char *dataPath) {
+    FILE *fp = fopen(dataPath, "r");
+    if (!fp) {
+        printf("Unable to open %s\n", dataPath);
+        return 0;
+    }
+
+    double counts[NB_MAX_CLASSES][NB_FEATURES][NB_STATES];
+    double classCounts[NB_MAX_CLASSES];
+    int seenStates[NB_FEATURES] = {0}; // sklearn sizes each feature by its largest category + 1
+    double total = 0;
+    char line[256];
+    memset(model, 0, sizeof(*model));
+
+    while (fgets(line, sizeof(line), fp)) {
+        char cells[NB_FEATURES][8], outcome[16];
+        if (sscanf(line, " %7[^,],%7[^,],%7[^,],%7[^,],%7[^,],%7[^,],%7[^,],%7[^,],%7[^,],%15s",
+                   cells[0], cells[1], cells[2], cells[3], cells[4], cells[5], cells[6], cells[7], cells[8], outcome) != 10)
+            continue; // skip empty or malformed lines
+
+        for (char *p = outcome; *p; p++) *p = (char)toupper((unsigned char)*p);
+        int c = classIndex(model, outcome, counts, classCounts);
+        if (c < 0) continue;
+
+        for (int i = 0; i < NB_FEATURES; i++) {
+            int state = stateOf(cells[i][0]);
+            counts[c][i][state]++;
+            if (state + 1 > seenStates[i]) seenStates[i] = state + 1;
+        }
+        classCounts[c]++;
+        total++;
+    }
+    fclose(fp);
+    if (total == 0) return 0;
+
+    // log P(class) and smoothed log P(cell state | class)
+    for (int c = 0; c < model->classCount; c++) {
+        model->classLogPrior[c] = log(classCounts[c]) - log(total);
+        for (int i = 0; i < NB_FEATURES; i++) {
+            double denom = log(classCounts[c] + NB_ALPHA * seenStates[i]);
+            for (int s = 0; s < NB_STATES; s++)
+                model->featureLogProb[i][c][s] = log(counts[c][i][s] + NB_ALPHA) - denom;
+        }
+    }
+    model->negativeClass = 0;
+    for (int c = 0; c < model->classCount; c++)
+        if (strcmp(model->classNames[c], "NEGATIVE") == 0) model->negativeClass = c;
+
+    memcpy(model->magic, NB_MODEL_MAGIC, sizeof(model->magic));
+    model->version = NB_MODEL_VERSION;
+    model->features = NB_FEATURES;
+    model->states = NB_STATES;
+    return 1;
+}
+
+int nbSaveModel(const NaiveBayesModel *model, const char *path) {
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        printf("Unable to write %s\n", path);
+        return 0;
+    }
+    int ok = fwrite(model, sizeof(*model), 1, fp) == 1;
+    return (fclose(fp) == 0) && ok;
+}
+
+// The mapping is only used if the header matches what this build was compiled for
+static int validModel(const NaiveBayesModel *model) {
+    return memcmp(model->magic, NB_MODEL_MAGIC, sizeof(model->magic)) == 0 &&
+           model->version == NB_MODEL_VERSION && model->features == NB_FEATURES && model->states == NB_STATES &&
+           model->classCount > 0 && model->classCount <= NB_MAX_CLASSES &&
+           model->negativeClass >= 0 && model->negativeClass < model->classCount;
+}
+
+const NaiveBayesModel *nbMapModel(const char *path) {
+    const NaiveBayesModel *model = NULL;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart == sizeof(NaiveBayesModel)) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            model = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping); // the view keeps the mapping alive
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size == (off_t)sizeof(NaiveBayesModel)) {
+        void *view = mmap(NULL, sizeof(NaiveBayesModel), PROT_READ, MAP_SHARED, fd, 0);
+        if (view != MAP_FAILED) model = view;
+    }
+    close(fd); // the mapping stays valid after the descriptor is closed
+#endif
+    if (model && !validModel(model)) {
+        printf("%s is not a version %d Naive Bayes model\n", path, NB_MODEL_VERSION);
+        nbUnmapModel(model);
+        model = NULL;
+    }
+    return model;
+}
+
+void nbUnmapModel(const NaiveBayesModel *model) {
+    if (!model) return;
+#ifdef _WIN32
+    UnmapViewOfFile(model);
+#else
+    munmap((void *)model, sizeof(NaiveBayesModel));
+#endif
+}
+
+// Posterior over the classes: joint log likelihood normalised with log-sum-exp
+void nbPredictProba(const NaiveBayesModel *model, const char *cells, double *proba) {
+    double jll[NB_MAX_CLASSES], maxJll = -INFINITY;
+    for (int c = 0; c < model->classCount; c++) {
+        jll[c] = model->classLogPrior[c];
+        for (int i = 0; i < NB_FEATURES; i++)
+            jll[c] += model->featureLogProb[i][c][stateOf(cells[i])];
+        if (jll[c] > maxJll) maxJll = jll[c];
+    }
+    double sum = 0;
+    for (int c = 0; c < model->classCount; c++) sum += exp(jll[c] - maxJll);
+    double logNorm = maxJll + log(sum);
+    for (int c = 0; c < model->classCount; c++) proba[c] = exp(jll[c] - logNorm);
+}
+
+// Same rule as mlalgo.predict(): play the empty cell that makes a NEGATIVE outcome (X not winning) most likely
+Move nbFindBestMove(const NaiveBayesModel *model, char board2D[SIZE][SIZE]) {
+    char cells[NB_FEATURES];
+    memcpy(cells, board2D, sizeof(cells));
+
+    int move = -1;
+    double best = -1, proba[NB_MAX_CLASSES];
+    for (int i = 0; i < NB_FEATURES; i++) {
+        if (stateOf(cells[i]) != 0) continue;
+        if (model->classCount == 0) { move = i; break; } // untrained model: first free cell
+        cells[i] = 'O';
+        nbPredictProba(model, cells, proba);
+        cells[i] = ' ';
+        if (proba[model->negativeClass] > best) {
+            best = proba[model->negativeClass];
+            move = i;
+        }
+    }
+    if (move < 0) move = 0; // full board, caller never asks
+    return (Move){move / SIZE, move % SIZE};
+}
@@ -0,0 +1,36 @@
+#ifndef NAIVE_BAYES_H
+#define NAIVE_BAYES_H
+
+#include <stdint.h>
+#include "minimax.h"
+
+// Categorical Naive Bayes over the 9 board cells, same model as sklearn's CategoricalNB(alpha=1)
+// fitted on OrdinalEncoder(categories=[["B","O","X"]] * 9) in mlalgo.py
+#define NB_FEATURES 9
+#define NB_STATES 3      // 0 = blank, 1 = O, 2 = X
+#define NB_MAX_CLASSES 4
+
+#define NB_MODEL_MAGIC "TTNB"
+#define NB_MODEL_VERSION 1
+
+// Fitted model. The layout is also the model file format (little-endian, no padding, 984 bytes), so a
+// model file can be memory-mapped and used as-is. mlalgo.export_model() writes the same layout
+typedef struct {
+    char magic[4];                          // NB_MODEL_MAGIC
+    int32_t version;                        // NB_MODEL_VERSION
+    int32_t features, states;               // NB_FEATURES, NB_STATES
+    int32_t classCount;
+    int32_t negativeClass;                  // index of "NEGATIVE" (X does not win)
+    char classNames[NB_MAX_CLASSES][16];    // sorted, like sklearn's classes_
+    double classLogPrior[NB_MAX_CLASSES];
+    double featureLogProb[NB_FEATURES][NB_MAX_CLASSES][NB_STATES];
+} NaiveBayesModel;
+
+int nbTrain(NaiveBayesModel *model, const char *dataPath); // 1 on success, 0 if the file can't be read
+int nbSaveModel(const NaiveBayesModel *model, const char *path); // 1 on success
+const NaiveBayesModel *nbMapModel(const char *path); // read-only mapping of a model file, NULL if missing or invalid
+void nbUnmapModel(const NaiveBayesModel *model);
+void nbPredictProba(const NaiveBayesModel *model, const char *cells, double *proba); // cells: 9 chars of 'X', 'O', ' '/'B'
+Move nbFindBestMove(const NaiveBayesModel *model, char board2D[SIZE][SIZE]); // AI plays 'O'
+
+#endif
@@ -0,0 +1,91 @@
+// Asset packer: decodes the game's images and sounds once and writes them to assets.pak (see asset_pack.h)
+// Build and run:  gcc pack_assets.c -lraylib -lm -o pack_assets && ./pack_assets [assets.pak]
+// Run it from the directory holding Graphics/ and Audio/, and again whenever one of the files changes
+#include <stdio.h>
+#include <string.h>
+#include "raylib.h"
+#include "asset_pack.h"
+
+// Everything the game loads at startup
+static const char *const imageFiles[] = { "Graphics/background.png", "Graphics/gameover.png" };
+static const char *const soundFiles[] = { "Audio/clicknew.mp3" };
+#define IMAGE_COUNT (int)(sizeof(imageFiles) / sizeof(imageFiles[0]))
+#define SOUND_COUNT (int)(sizeof(soundFiles) / sizeof(soundFiles[0]))
+
+static AssetPackHeader header;
+static Image images[IMAGE_COUNT];
+static Wave sounds[SOUND_COUNT];
+
+static int64_t alignUp(int64_t offset) {
+    return (offset + ASSET_PACK_ALIGN - 1) / ASSET_PACK_ALIGN * ASSET_PACK_ALIGN;
+}
+
+static AssetEntry *addEntry(const char *name, AssetKind kind, int64_t size) {
+    AssetEntry *e = &header.entries[header.count];
+    int64_t end = header.count ? header.entries[header.count - 1].offset + header.entries[header.count - 1].size
+                               : (int64_t)sizeof(header);
+    header.count++;
+    snprintf(e->name, sizeof(e->name), "%s", name);
+    e->kind = kind;
+    e->offset = alignUp(end);
+    e->size = size;
+    return e;
+}
+
+int main(int argc, char **argv) {
+    const char *outPath = argc > 1 ? argv[1] : "assets.pak";
+    SetTraceLogLevel(LOG_WARNING);
+    memcpy(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic));
+    header.version = ASSET_PACK_VERSION;
+
+    // Pixels stay in the format the file decodes to; the game uploads them as they are
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        images[i] = LoadImage(imageFiles[i]);
+        if (!images[i].data) {
+            printf("Unable to load %s\n", imageFiles[i]);
+            return 1;
+        }
+        AssetEntry *e = addEntry(imageFiles[i], ASSET_IMAGE,
+                                 GetPixelDataSize(images[i].width, images[i].height, images[i].format));
+        e->width = images[i].width;
+        e->height = images[i].height;
+        e->format = images[i].format;
+    }
+
+    // Samples as 16-bit PCM at the file's rate, the format LoadSound would convert them to anyway
+    for (int i = 0; i < SOUND_COUNT; i++) {
+        sounds[i] = LoadWave(soundFiles[i]);
+        if (!sounds[i].data) {
+            printf("Unable to load %s\n", soundFiles[i]);
+            return 1;
+        }
+        WaveFormat(&sounds[i], sounds[i].sampleRate, 16, sounds[i].channels);
+        AssetEntry *e = addEntry(soundFiles[i], ASSET_SOUND, (int64_t)sounds[i].frameCount * sounds[i].channels * 2);
+        e->sampleRate = sounds[i].sampleRate;
+        e->channels = sounds[i].channels;
+        e->frameCount = sounds[i].frameCount;
+    }
+
+    FILE *fp = fopen(outPath, "wb");
+    if (!fp) {
+        printf("Unable to write %s\n", outPath);
+        return 1;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+    for (int i = 0; i < header.count && ok; i++) {
+        const AssetEntry *e = &header.entries[i];
+        const void *data = e->kind == ASSET_IMAGE ? images[i].data : sounds[i - IMAGE_COUNT].data;
+        ok = fseek(fp, (long)e->offset, SEEK_SET) == 0 && fwrite(data, 1, (size_t)e->size, fp) == (size_t)e->size;
+    }
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok) {
+        printf("Unable to write %s\n", outPath);
+        return 1;
+    }
+
+    for (int i = 0; i < header.count; i++)
+        printf("%-26s %9lld bytes\n", header.entries[i].name, (long long)header.entries[i].size);
+    for (int i = 0; i < IMAGE_COUNT; i++) UnloadImage(images[i]);
+    for (int i = 0; i < SOUND_COUNT; i++) UnloadWave(sounds[i]);
+    return 0;
+}
@@ -0,0 +1,25 @@
+#ifndef RNG_H
+#define RNG_H
+
+// Small seeded PRNG (splitmix64). Each search/thread owns one so results only depend on the seed
+typedef struct {
+    unsigned long long state;
+} Rng;
+
+static inline void rngSeed(Rng *rng, unsigned long long seed) {
+    rng->state = seed;
+}
+
+static inline unsigned long long rngNext(Rng *rng) {
+    unsigned long long z = (rng->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Uniform-enough integer in [0, n) for the small n used here
+static inline int rngRange(Rng *rng, int n) {
+    return (int)(rngNext(rng) % (unsigned long long)n);
+}
+
+#endif
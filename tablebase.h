@@ -0,0 +1,1665 @@
+// Generated by gen_tablebase.c - do not edit.
+// Perfect-play value of every reachable position (10956 entries solved), indexed by
+// [side to move: 0 = X, 1 = O][sum(cell * 3^i), cell 0 = empty, 1 = X, 2 = O, i = row * 3 + col]
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#define TB_UNSOLVED 0
+#define TB_LOSS 1
+#define TB_DRAW 2
+#define TB_WIN 3
+
+#define TB_VALUE(e) ((e) >> 13)       // value for the side to move, TB_UNSOLVED if unreachable
+#define TB_DIST(e)  (((e) >> 9) & 0xF) // plies to the end of the game under perfect play
+#define TB_MOVES(e) ((e) & 0x1FF)      // bit (row * 3 + col) set for every optimal move
+
+static const unsigned short tablebase[2][19683] = {
+{
+21503,0,20496,0,0,20312,20629,27224,0,0,0,27488,0,0,0,27440,0,27424,20496,27464,0,20336,0,19472,
+0,27208,0,0,0,20246,0,0,0,27153,0,10244,0,0,0,0,0,0,0,0,26160,27137,0,10242,
+0,0,26128,27137,25152,0,20593,27158,0,27153,0,10304,0,19632,0,27409,0,10304,0,0,10304,27392,26384,0,
+0,19504,0,19472,26128,0,0,0,0,0,0,20462,0,0,0,27501,0,19460,0,0,0,0,0,0,
+0,0,25152,20459,0,19458,0,0,25216,19457,25344,0,0,0,0,0,0,0,0,0,25120,0,0,0,
+0,0,0,0,0,0,0,0,25120,0,0,0,25120,0,8192,27591,0,19520,0,0,25216,19525,25344,0,
+0,0,25152,0,0,0,25152,0,25152,19651,25344,0,25216,0,25216,0,25344,0,20805,20462,0,20333,0,10496,
+0,19584,0,20459,0,19712,0,0,19200,19584,19072,0,0,19520,0,10304,19008,0,0,0,0,20423,0,10496,
+0,0,19200,10368,25152,0,0,0,19200,0,0,0,19072,0,9696,10304,25152,0,19008,0,9696,0,25152,0,
+0,19488,0,10272,25092,0,0,0,0,19488,25090,0,25089,0,9696,0,9696,0,0,0,0,0,9696,0,
+0,0,0,0,0,27140,0,0,0,27156,0,27140,0,0,0,0,0,0,0,0,25344,20051,0,10242,
+0,0,26128,10241,26136,0,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,0,0,0,0,
+0,0,25104,0,0,0,25104,0,8192,20439,0,19520,0,0,27200,19521,26368,0,0,0,25344,0,0,0,
+25344,0,25344,19521,19410,0,19153,0,18496,0,18640,0,0,0,0,0,0,0,0,0,25096,0,0,0,
+0,0,0,0,0,0,0,0,25096,0,0,0,25096,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19008,0,0,0,
+26372,0,9668,0,0,0,0,0,0,0,0,25408,19139,0,9666,0,0,25216,18433,25344,0,20423,0,10496,
+0,0,19200,10368,19072,0,0,0,25344,0,0,0,25344,0,25344,10304,19008,0,19008,0,9672,0,9672,0,
+0,0,10496,0,0,0,10368,0,9668,0,0,0,0,0,0,0,0,25344,10304,0,9666,0,0,9664,
+9665,25152,0,19781,26116,0,26116,0,9668,0,18560,0,25344,0,25344,0,0,25344,25344,25344,0,0,18496,0,
+18496,17984,0,0,0,0,20764,27220,0,27156,0,19472,0,27200,0,27155,0,19480,0,0,26128,19608,26192,0,
+0,10496,0,10496,10496,0,0,0,0,20439,0,19716,0,0,19348,19716,25152,0,0,0,19410,0,0,0,
+26176,0,18832,19712,25152,0,27392,0,18688,0,25152,0,0,27152,0,27152,25092,0,0,0,0,27152,25090,0,
+25089,0,9680,0,26128,0,0,0,0,0,9680,0,0,0,0,27591,0,19846,0,0,25216,19717,25344,0,
+0,0,25152,0,0,0,25152,0,25152,19712,25344,0,25216,0,25216,0,25344,0,0,0,19334,0,0,0,
+26177,0,18436,0,0,0,0,0,0,0,0,25152,19200,0,9666,0,0,25216,9665,25408,0,27591,25344,0,
+25216,0,25216,0,25344,0,25152,0,25152,0,0,25280,25152,25408,0,0,25344,0,25216,25472,0,0,0,0,
+0,19464,0,10248,25092,0,0,0,0,19464,25090,0,25089,0,9672,0,9672,0,0,0,0,0,9672,0,
+0,0,0,19781,25152,0,26113,0,18688,0,25152,0,26113,0,18688,0,0,18176,18560,25152,0,0,25152,0,
+9665,25152,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,27524,0,0,0,27409,0,10244,0,0,0,0,0,0,
+0,0,25104,27393,0,10242,0,0,26240,27137,25096,0,0,0,0,0,0,0,0,0,10244,0,0,0,
+0,0,0,0,0,0,0,0,10242,0,0,0,25089,0,8192,27536,0,27520,0,0,26256,27392,26384,0,
+0,0,25104,0,0,0,25104,0,25104,19760,26368,0,26240,0,26240,0,26368,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,18946,0,0,0,26113,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,26496,0,18434,0,0,25216,
+18433,25344,0,20399,0,19712,0,0,19200,19584,25096,0,0,0,26368,0,0,0,19072,0,9640,19713,25096,0,
+19241,0,18688,0,25096,0,0,0,19200,0,0,0,25089,0,9636,0,0,0,0,0,0,0,0,9632,
+25089,0,9634,0,0,18176,25089,0,0,19488,18976,0,18976,0,9636,0,9636,0,18976,0,9634,0,0,9632,
+9633,9632,0,0,18464,0,18464,17952,0,0,0,0,0,0,0,0,0,0,0,0,26116,0,0,0,
+0,0,0,0,0,0,0,0,18946,0,0,0,27137,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,26372,0,0,0,
+26372,0,26116,0,0,0,0,0,0,0,0,25360,19347,0,18434,0,0,26240,18433,26368,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,17922,
+0,0,0,17921,0,8192,0,0,26368,0,0,0,19072,0,9612,0,0,0,0,0,0,0,0,25344,
+19331,0,9610,0,0,18176,9609,25096,0,0,0,0,0,0,0,0,0,9604,0,0,0,0,0,0,
+0,0,0,0,0,9602,0,0,0,25089,0,8192,26368,0,26368,0,0,26368,18560,18048,0,0,0,25344,
+0,0,0,25344,0,25344,18819,18306,0,18305,0,17664,0,17536,0,27409,0,19712,0,0,26256,27393,25096,0,
+0,0,25104,0,0,0,25104,0,25104,27392,25096,0,27392,0,18688,0,25096,0,0,0,19204,0,0,0,
+25089,0,10244,0,0,0,0,0,0,0,0,25104,25089,0,9618,0,0,18176,25089,0,0,27152,26128,0,
+26128,0,26128,0,26128,0,25104,0,25104,0,0,25104,25104,25104,0,0,9618,0,9617,9616,0,0,0,0,
+0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,26368,0,9610,0,0,25216,
+9609,25352,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,9602,
+0,0,0,25089,0,8192,25092,0,25092,0,0,25220,25092,25348,0,0,0,0,0,0,0,0,0,0,
+26368,25344,0,25216,0,25216,0,25344,0,19464,25096,0,18952,0,9612,0,25096,0,18952,0,9610,0,0,9608,
+9609,25096,0,0,25096,0,9609,25096,0,0,0,0,25089,0,18688,0,0,18176,25089,0,0,0,0,18176,
+0,0,0,25089,0,9600,25089,0,0,25089,0,17664,0,0,0,0,8192,0,8192,8192,0,0,0,0,
+8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,20496,27398,0,27137,0,10248,
+0,19600,0,27393,0,10248,0,0,10248,19856,26368,0,0,10256,0,19472,26128,0,0,0,0,20372,0,19472,
+0,0,26128,19472,26128,0,0,0,26144,0,0,0,26144,0,26144,19472,26128,0,26128,0,26128,0,26128,0,
+0,27142,0,27137,25092,0,0,0,0,27137,25090,0,25089,0,8192,0,26368,0,0,0,0,0,26128,0,
+0,0,0,20399,0,19464,0,0,25216,19501,25344,0,0,0,18952,0,0,0,26400,0,18440,19626,25344,0,
+25216,0,25216,0,25344,0,0,0,25120,0,0,0,25120,0,25120,0,0,0,0,0,0,0,0,25120,
+25120,0,25120,0,0,25248,25120,25376,0,19457,25344,0,25216,0,8192,0,25344,0,26113,0,8192,0,0,8192,
+18433,25344,0,0,25344,0,25216,25472,0,0,0,0,0,19460,0,10244,25092,0,0,0,0,19713,25090,0,
+25089,0,9640,0,18560,0,0,0,0,0,8192,0,0,0,0,10244,18948,0,18948,0,9636,0,9636,0,
+19331,0,18688,0,0,18176,18560,18048,0,0,8192,0,8192,8192,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27392,0,10248,
+0,0,10248,19472,26384,0,0,0,25344,0,0,0,25344,0,25344,19472,26128,0,26128,0,9624,0,26128,0,
+0,0,25104,0,0,0,25104,0,25104,0,0,0,0,0,0,0,0,25360,25104,0,25104,0,0,25104,
+25104,25104,0,19457,26372,0,27137,0,8192,0,26368,0,25344,0,8192,0,0,8192,25344,25344,0,0,18448,0,
+9617,26128,0,0,0,0,0,0,25096,0,0,0,25096,0,25096,0,0,0,0,0,0,0,0,25352,
+25096,0,25096,0,0,25224,25096,25352,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,18945,0,8192,0,0,8192,18433,25344,0,0,0,8192,
+0,0,0,25344,0,8192,18433,25344,0,25216,0,8192,0,25344,0,10244,26116,0,26116,0,9612,0,9612,0,
+25344,0,25344,0,0,25344,25344,25344,0,0,8192,0,8192,8192,0,0,0,0,10244,0,9606,0,0,9604,
+9605,9604,0,0,0,25344,0,0,0,25344,0,25344,8192,8192,0,8192,0,8192,0,8192,0,0,26116,0,
+9605,25092,0,0,0,0,25344,25346,0,25345,0,8192,0,25344,0,0,0,0,0,8192,0,0,0,0,
+0,19460,0,19472,25092,0,0,0,0,19481,25090,0,25089,0,10248,0,18576,0,0,0,0,0,9624,0,
+0,0,0,19716,19204,0,19348,0,18704,0,10644,0,19347,0,18832,0,0,18320,18832,18320,0,0,9618,0,
+9617,9616,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19846,25344,0,25216,0,25216,0,25344,0,26115,0,18440,0,0,25216,
+18825,25344,0,0,25344,0,25216,25472,0,0,0,0,19334,0,18822,0,0,25216,18692,25344,0,0,0,18306,
+0,0,0,18305,0,17792,18688,25344,0,25216,0,25216,0,25344,0,0,25344,0,25216,25476,0,0,0,0,
+26113,25346,0,25217,0,8192,0,25344,0,0,0,0,0,25472,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18436,0,
+18436,25092,0,0,0,0,18819,25090,0,25089,0,17664,0,17536,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,27200,0,0,0,20349,0,19460,0,0,0,0,0,0,0,0,26432,27392,0,10242,
+0,0,25104,19457,26432,0,0,0,0,0,0,0,0,0,27140,0,0,0,0,0,0,0,0,0,
+0,0,10242,0,0,0,27137,0,8192,27216,0,27200,0,0,25104,19461,26368,0,0,0,26176,0,0,0,
+26432,0,26176,19472,26384,0,25104,0,25104,0,26368,0,0,0,0,0,0,0,0,0,18948,0,0,0,
+0,0,0,0,0,0,0,0,25090,0,0,0,18945,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25090,0,0,0,
+26432,0,9572,0,0,0,0,0,0,0,0,25152,25090,0,25090,0,0,0,18433,25344,0,20333,0,10496,
+0,0,10496,19781,26176,0,0,0,26368,0,0,0,26368,0,26368,10304,26176,0,10304,0,9576,0,26176,0,
+0,0,19200,0,0,0,26176,0,9572,0,0,0,0,0,0,0,0,26368,26176,0,9570,0,0,9568,
+9569,25152,0,10272,18976,0,10272,0,9572,0,18464,0,18976,0,9570,0,0,9568,18464,17952,0,0,9570,0,
+9569,9568,0,0,0,0,0,0,0,0,0,0,0,0,27140,0,0,0,0,0,0,0,0,0,
+0,0,10242,0,0,0,27137,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8192,0,0,27200,0,0,0,26368,0,9556,0,0,0,
+0,0,0,0,0,25344,19027,0,9554,0,0,25104,18433,26368,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9540,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,17921,0,8192,
+0,0,26368,0,0,0,26368,0,9548,0,0,0,0,0,0,0,0,25344,19008,0,9546,0,0,9544,
+9545,26176,0,0,0,0,0,0,0,0,0,9540,0,0,0,0,0,0,0,0,0,0,0,9538,
+0,0,0,9537,0,8192,26368,0,9542,0,0,9540,26368,26368,0,0,0,25344,0,0,0,25344,0,25344,
+18496,17984,0,17984,0,9536,0,17472,0,27408,0,19472,0,0,25104,19461,26432,0,0,0,26192,0,0,0,
+26176,0,26176,27392,26368,0,25104,0,25104,0,26368,0,0,0,19222,0,0,0,26176,0,18436,0,0,0,
+0,0,0,0,0,26176,27392,0,9554,0,0,25104,9553,25152,0,27152,26128,0,25104,0,25104,0,18448,0,
+26128,0,9554,0,0,25104,18448,26128,0,0,9554,0,25104,25104,0,0,0,0,0,0,25090,0,0,0,
+26432,0,18436,0,0,0,0,0,0,0,0,25152,25090,0,25090,0,0,0,9545,25344,0,0,0,0,
+0,0,0,0,0,17924,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,9537,0,8192,
+25090,0,25090,0,0,0,26432,25344,0,0,0,25154,0,0,0,25152,0,25152,25090,25346,0,0,0,0,
+0,25344,0,10248,18952,0,10248,0,9548,0,18440,0,18952,0,9546,0,0,9544,18440,17928,0,0,9546,0,
+9545,9544,0,0,0,0,26176,0,18688,0,0,18176,26176,25152,0,0,0,18176,0,0,0,26176,0,17664,
+9539,25152,0,9537,0,9536,0,25152,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,8192,0,8192,
+0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,25344,0,0,0,
+0,0,0,0,0,0,0,0,25344,0,0,0,25344,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25344,0,0,0,
+25344,0,25344,0,0,0,0,0,0,0,0,25360,25344,0,25344,0,0,25360,25344,25344,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25348,0,0,0,0,0,0,0,0,0,0,0,25346,
+0,0,0,25344,0,8192,0,0,25344,0,0,0,25344,0,25344,0,0,0,0,0,0,0,0,25344,
+25344,0,25344,0,0,25344,25344,25352,0,0,0,0,0,0,0,0,0,25344,0,0,0,0,0,0,
+0,0,0,0,0,25344,0,0,0,25345,0,8192,25344,0,25344,0,0,25344,25344,25344,0,0,0,25344,
+0,0,0,25344,0,25344,25344,25344,0,25344,0,25344,0,25344,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,25344,0,0,0,0,0,0,0,0,0,0,0,25344,0,0,0,25344,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,25344,0,0,0,0,0,0,
+0,0,0,0,0,25344,0,0,0,25344,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25344,0,0,0,25344,0,25344,
+0,0,0,0,0,0,0,0,25344,25344,0,25344,0,0,25344,25344,25344,0,0,0,25344,0,0,0,
+25344,0,25344,0,0,0,0,0,0,0,0,25360,25344,0,25344,0,0,25360,25344,25352,0,0,0,0,
+0,0,0,0,0,25344,0,0,0,0,0,0,0,0,0,0,0,25344,0,0,0,25345,0,8192,
+25344,0,25344,0,0,25360,25344,25344,0,0,0,25360,0,0,0,25360,0,25360,25344,25344,0,25360,0,25360,
+0,25344,0,0,0,0,0,0,0,0,0,25348,0,0,0,0,0,0,0,0,0,0,0,25346,
+0,0,0,25344,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,25350,0,0,0,25348,0,25348,0,0,0,0,0,0,
+0,0,0,25346,0,25346,0,0,0,25344,25344,0,25344,0,25344,0,0,25344,25344,25352,0,0,0,25344,
+0,0,0,25344,0,25344,25344,25352,0,25344,0,25344,0,25352,0,0,0,25344,0,0,0,25345,0,25344,
+0,0,0,0,0,0,0,0,25344,25345,0,25344,0,0,25344,25345,0,0,8192,8192,0,8192,0,8192,
+0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,8192,0,8192,8192,0,0,0,0,19997,0,10248,
+0,0,25104,19461,19260,0,0,0,18952,0,0,0,19257,0,18440,19472,26128,0,25104,0,25104,0,18448,0,
+0,0,26128,0,0,0,18997,0,18436,0,0,0,0,0,0,0,0,26144,26128,0,9522,0,0,25104,
+9521,26128,0,10241,26130,0,25104,0,8192,0,18484,0,27137,0,8192,0,0,8192,18433,26368,0,0,26128,0,
+25104,25104,0,0,0,0,0,0,25090,0,0,0,18989,0,9516,0,0,0,0,0,0,0,0,17928,
+25090,0,25090,0,0,0,18433,25344,0,0,0,0,0,0,0,0,0,25120,0,0,0,0,0,0,
+0,0,0,0,0,25122,0,0,0,25120,0,8192,25090,0,8192,0,0,0,18433,25344,0,0,0,8192,
+0,0,0,17921,0,8192,25090,25346,0,0,0,0,0,25344,0,10244,18948,0,10244,0,9516,0,18436,0,
+19241,0,9514,0,0,9512,18729,18216,0,0,8192,0,8192,8192,0,0,0,0,18948,0,9510,0,0,9508,
+18436,17924,0,0,0,18176,0,0,0,18209,0,17664,8192,8192,0,8192,0,8192,0,8192,0,0,9510,0,
+9509,25092,0,0,0,0,9507,25090,0,25089,0,8192,0,17440,0,0,0,0,0,8192,0,0,0,0,
+0,0,10248,0,0,0,18973,0,9500,0,0,0,0,0,0,0,0,25344,26128,0,9498,0,0,25104,
+9497,26128,0,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,0,0,0,0,0,0,25104,
+0,0,0,25104,0,8192,27137,0,8192,0,0,8192,18433,26368,0,0,0,8192,0,0,0,25344,0,8192,
+9491,26128,0,25104,0,8192,0,17424,0,0,0,0,0,0,0,0,0,25096,0,0,0,0,0,0,
+0,0,0,0,0,25098,0,0,0,25096,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,17921,0,8192,
+0,0,0,0,0,0,0,0,8192,25090,0,8192,0,0,0,17409,25344,0,18948,0,9486,0,0,9484,
+18436,17924,0,0,0,25344,0,0,0,25344,0,25344,8192,8192,0,8192,0,8192,0,8192,0,0,0,9478,
+0,0,0,17924,0,9476,0,0,0,0,0,0,0,0,25344,8192,0,8192,0,0,8192,8192,8192,0,
+9479,26116,0,9477,0,8192,0,17412,0,25344,0,8192,0,0,8192,25344,25344,0,0,8192,0,8192,8192,0,
+0,0,0,19472,26130,0,25104,0,25104,0,18452,0,26114,0,18440,0,0,25104,18457,18200,0,0,9498,0,
+25104,25104,0,0,0,0,19222,0,18452,0,0,25104,18436,18196,0,0,0,18194,0,0,0,18193,0,17680,
+9491,9490,0,25104,0,25104,0,9488,0,0,26128,0,25104,25108,0,0,0,0,9491,25090,0,25105,0,8192,
+0,17424,0,0,0,0,0,25104,0,0,0,0,25090,0,25090,0,0,0,18437,25344,0,0,0,25090,
+0,0,0,18185,0,17416,25090,25346,0,0,0,0,0,25344,0,0,0,25090,0,0,0,18181,0,17412,
+0,0,0,0,0,0,0,0,17152,25090,0,25090,0,0,0,9473,25344,0,25090,25346,0,0,0,0,
+0,25344,0,25090,0,8192,0,0,0,17409,25344,0,0,25346,0,0,0,0,0,0,0,0,9486,0,
+9485,25092,0,0,0,0,18440,25090,0,25089,0,9480,0,17416,0,0,0,0,0,8192,0,0,0,0,
+18436,17924,0,17924,0,9476,0,17412,0,18179,0,17664,0,0,17152,17665,17152,0,0,8192,0,8192,8192,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,20818,27220,0,20349,0,19776,0,27152,0,27409,0,19712,0,0,19264,27152,26128,0,
+0,19520,0,19776,19264,0,0,0,0,27216,0,19472,0,0,19312,27152,25152,0,0,0,26160,0,0,0,
+26128,0,26128,19472,25152,0,19312,0,18704,0,25152,0,0,27140,0,19776,25092,0,0,0,0,27393,25090,0,
+25089,0,10304,0,26128,0,0,0,0,0,10608,0,0,0,0,27501,0,19816,0,0,19304,27501,25344,0,
+0,0,25152,0,0,0,25152,0,25152,19816,25344,0,19304,0,18792,0,25344,0,0,0,25120,0,0,0,
+25120,0,25120,0,0,0,0,0,0,0,0,25184,25120,0,25120,0,0,25120,25120,25440,0,19777,25344,0,
+26117,0,18496,0,25344,0,25152,0,25152,0,0,25152,25152,25408,0,0,25344,0,18752,25344,0,0,0,0,
+0,19458,0,19781,25092,0,0,0,0,19458,25090,0,25089,0,18688,0,8192,0,0,0,0,0,18496,0,
+0,0,0,10242,25152,0,26113,0,18688,0,8192,0,18946,0,9570,0,0,18176,8192,8192,0,0,25152,0,
+18496,25152,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,27408,0,19472,0,0,19288,27152,26128,0,0,0,25344,0,0,0,
+25344,0,25344,19472,26136,0,19288,0,18512,0,26128,0,0,0,25104,0,0,0,25104,0,25104,0,0,0,
+0,0,0,0,0,25360,25104,0,25104,0,0,25104,25104,25168,0,19521,26372,0,26116,0,18496,0,18448,0,
+25344,0,25344,0,0,25344,25344,25344,0,0,18512,0,18496,18256,0,0,0,0,0,0,25096,0,0,0,
+25096,0,25096,0,0,0,0,0,0,0,0,25416,25096,0,25096,0,0,25096,25096,25352,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+26372,0,18496,0,0,17984,26372,25344,0,0,0,25408,0,0,0,25408,0,25408,18497,25344,0,18241,0,17472,
+0,25344,0,10242,18946,0,26116,0,18688,0,8192,0,25344,0,25344,0,0,25344,8192,8192,0,0,9546,0,
+18496,17984,0,0,0,0,10242,0,9542,0,0,18176,8192,8192,0,0,0,25344,0,0,0,8192,0,8192,
+9539,25152,0,17984,0,9536,0,8192,0,0,18434,0,26116,25092,0,0,0,0,25344,25346,0,25345,0,25344,
+0,8192,0,0,0,0,0,17472,0,0,0,0,0,27204,0,19776,25092,0,0,0,0,27137,25090,0,
+25089,0,10584,0,26128,0,0,0,0,0,10496,0,0,0,0,19716,25152,0,26113,0,18688,0,25152,0,
+26177,0,18704,0,0,18256,18448,25152,0,0,25152,0,18688,25152,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19780,25344,0,
+26117,0,18752,0,25344,0,25152,0,25152,0,0,25152,25152,25408,0,0,25344,0,18688,25344,0,0,0,0,
+26177,0,18692,0,0,18244,26177,25408,0,0,0,25152,0,0,0,25152,0,25152,18688,25408,0,18176,0,17664,
+0,25408,0,0,25344,0,26117,25348,0,0,0,0,25152,25410,0,25153,0,25152,0,25408,0,0,0,0,
+0,25344,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25152,0,26113,25156,0,0,0,0,18434,25154,0,25089,0,17664,
+0,8192,0,0,0,0,0,25152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27161,0,19474,0,0,19260,27152,25096,0,
+0,0,25104,0,0,0,25104,0,25104,19475,25096,0,19257,0,18736,0,25096,0,0,0,26128,0,0,0,
+25089,0,9524,0,0,0,0,0,0,0,0,25104,25089,0,10242,0,0,18224,25089,0,0,19506,26132,0,
+26116,0,18736,0,26128,0,25104,0,25104,0,0,25104,25104,25104,0,0,18480,0,18736,18224,0,0,0,0,
+0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,26121,0,18434,0,0,18216,
+26113,25352,0,0,0,0,0,0,0,0,0,25124,0,0,0,0,0,0,0,0,0,0,0,25120,
+0,0,0,25121,0,8192,25092,0,25092,0,0,25092,25092,25348,0,0,0,0,0,0,0,0,0,0,
+18723,25344,0,18209,0,17696,0,25344,0,19458,25096,0,26113,0,18688,0,8192,0,18946,0,9514,0,0,18176,
+8192,8192,0,0,25096,0,18729,25096,0,0,0,0,25089,0,9510,0,0,18176,8192,0,0,0,0,9506,
+0,0,0,8192,0,8192,25089,0,0,25089,0,17664,0,0,0,0,9510,0,18464,25092,0,0,0,0,
+9507,25090,0,25089,0,9504,0,8192,0,0,0,0,0,17440,0,0,0,0,0,0,26132,0,0,0,
+26128,0,9500,0,0,0,0,0,0,0,0,25360,26120,0,18434,0,0,18200,9497,25096,0,0,0,0,
+0,0,0,0,0,25104,0,0,0,0,0,0,0,0,0,0,0,25104,0,0,0,25105,0,8192,
+26116,0,26116,0,0,26116,18448,26128,0,0,0,25360,0,0,0,25360,0,25360,18451,18194,0,18193,0,17680,
+0,17424,0,0,0,0,0,0,0,0,0,25100,0,0,0,0,0,0,0,0,0,0,0,25096,
+0,0,0,25096,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,
+0,0,0,18179,0,17410,0,0,17152,17409,25344,0,18946,0,9486,0,0,18176,8192,8192,0,0,0,25344,
+0,0,0,8192,0,8192,18434,25096,0,18185,0,17664,0,8192,0,0,0,9478,0,0,0,8192,0,8192,
+0,0,0,0,0,0,0,0,8192,25089,0,9474,0,0,17152,8192,0,0,18434,17922,0,26116,0,17664,
+0,8192,0,25344,0,25344,0,0,25344,8192,8192,0,0,17410,0,17665,17152,0,0,0,0,27137,25096,0,
+26117,0,18704,0,25096,0,25104,0,25104,0,0,25104,25104,25112,0,0,25096,0,18688,25096,0,0,0,0,
+25089,0,10518,0,0,18196,25089,0,0,0,0,25104,0,0,0,25105,0,25104,25089,0,0,25089,0,17664,
+0,0,0,0,26128,0,18448,25092,0,0,0,0,25104,25106,0,25105,0,25104,0,25104,0,0,0,0,
+0,9488,0,0,0,0,25092,0,25092,0,0,25092,25092,25356,0,0,0,0,0,0,0,0,0,0,
+18688,25352,0,18176,0,17664,0,25352,0,0,0,25092,0,0,0,25093,0,25092,0,0,0,0,0,0,
+0,0,0,25089,0,9474,0,0,17152,25089,0,0,25092,25348,0,25092,0,25092,0,25348,0,0,0,0,
+0,0,0,0,0,0,0,25344,0,17664,25344,0,0,0,0,0,25096,0,18440,25100,0,0,0,0,
+9483,25098,0,25089,0,9480,0,8192,0,0,0,0,0,25096,0,0,0,0,25089,0,0,25089,0,17664,
+0,0,0,25089,0,9474,0,0,17152,8192,0,0,0,0,0,25089,0,0,0,0,0,0,0,0,
+0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,10496,0,19712,25092,0,0,0,0,27392,25090,0,25089,0,9528,0,9528,0,0,0,0,0,9528,0,
+0,0,0,10496,10496,0,27392,0,18688,0,9524,0,27392,0,18688,0,0,18176,9521,9520,0,0,9522,0,
+9521,9520,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19712,25344,0,19200,0,9516,0,25344,0,26368,0,9514,0,0,9512,
+26368,25344,0,0,25344,0,18688,25344,0,0,0,0,25120,0,25120,0,0,25120,25120,25376,0,0,0,25120,
+0,0,0,25120,0,25120,25120,25376,0,25120,0,25120,0,25376,0,0,25344,0,9509,25348,0,0,0,0,
+9507,25346,0,25089,0,8192,0,25344,0,0,0,0,0,25344,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9510,0,
+9509,25092,0,0,0,0,9507,25090,0,25089,0,17664,0,8192,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,27392,26368,0,27392,0,9500,0,9500,0,25344,0,25344,0,0,25344,25344,25344,0,0,9498,0,
+9497,9496,0,0,0,0,25104,0,25104,0,0,25104,25104,25104,0,0,0,25360,0,0,0,25360,0,25360,
+25104,25104,0,25104,0,25104,0,25104,0,0,26368,0,9493,25092,0,0,0,0,25344,25346,0,25345,0,8192,
+0,25344,0,0,0,0,0,9488,0,0,0,0,25096,0,25096,0,0,25096,25096,25352,0,0,0,25352,
+0,0,0,25352,0,25352,25096,25352,0,25096,0,25096,0,25352,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9479,25344,0,9477,0,8192,
+0,25344,0,25344,0,8192,0,0,8192,25344,25344,0,0,25344,0,9473,25344,0,0,0,0,0,9486,0,
+9485,25092,0,0,0,0,25344,25346,0,25345,0,25344,0,8192,0,0,0,0,0,8192,0,0,0,0,
+9479,9478,0,9477,0,9476,0,8192,0,25344,0,25344,0,0,25344,8192,8192,0,0,8192,0,8192,8192,0,
+0,0,0,0,0,0,0,25092,0,0,0,0,0,25346,0,25345,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,10496,0,18688,25092,0,0,0,0,18688,25090,0,25089,0,17664,
+0,9488,0,0,0,0,0,9488,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25344,0,18688,25348,0,0,0,0,
+18688,25346,0,25089,0,9480,0,25344,0,0,0,0,0,25344,0,0,0,0,18688,25344,0,18176,0,17664,
+0,25344,0,18176,0,17664,0,0,17152,17664,25344,0,0,25344,0,17664,25344,0,0,0,0,0,0,0,
+0,25348,0,0,0,0,0,25346,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,27204,0,0,0,27220,0,27140,0,0,0,0,0,0,
+0,0,25120,27329,0,10242,0,0,26240,10241,25104,0,0,0,0,0,0,0,0,0,27140,0,0,0,
+0,0,0,0,0,0,0,0,18946,0,0,0,26113,0,8192,27220,0,27200,0,0,27200,27204,25104,0,
+0,0,25120,0,0,0,25120,0,25120,19520,25104,0,26256,0,18496,0,25104,0,0,0,0,0,0,0,
+0,0,26116,0,0,0,0,0,0,0,0,0,0,0,18946,0,0,0,25089,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,26176,0,0,0,25089,0,9444,0,0,0,0,0,0,0,0,25184,25089,0,9442,0,0,25216,
+25089,0,0,20207,0,19524,0,0,19052,19584,19072,0,0,0,25120,0,0,0,25120,0,25120,19520,26176,0,
+19008,0,18496,0,9448,0,0,0,19142,0,0,0,19072,0,9444,0,0,0,0,0,0,0,0,25120,
+26176,0,9442,0,0,17984,9441,25152,0,19488,18976,0,18976,0,9444,0,9444,0,25120,0,25120,0,0,25120,
+25120,25120,0,0,9442,0,9441,9440,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,10242,0,0,0,10241,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25092,0,0,0,
+25092,0,25092,0,0,0,0,0,0,0,0,0,19009,0,9426,0,0,17984,10241,25104,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,9410,
+0,0,0,25089,0,8192,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,
+19008,0,9418,0,0,17984,9417,9416,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,
+0,0,0,0,0,9410,0,0,0,9409,0,8192,25092,0,25092,0,0,25092,25092,25092,0,0,0,0,
+0,0,0,0,0,0,18496,17984,0,17984,0,17472,0,9408,0,27344,0,19544,0,0,26240,27200,25104,0,
+0,0,26176,0,0,0,26192,0,26176,27328,25104,0,26256,0,26240,0,25104,0,0,0,19158,0,0,0,
+26177,0,18436,0,0,0,0,0,0,0,0,26176,26177,0,18434,0,0,26240,26113,25168,0,27152,25104,0,
+26128,0,9428,0,25104,0,26128,0,9426,0,0,9424,26128,25104,0,0,25104,0,26128,25104,0,0,0,0,
+0,0,26304,0,0,0,25089,0,18436,0,0,0,0,0,0,0,0,25152,25089,0,18434,0,0,25216,
+25089,0,0,0,0,0,0,0,0,0,0,17924,0,0,0,0,0,0,0,0,0,0,0,17922,
+0,0,0,25089,0,8192,25089,0,26176,0,0,25216,25089,0,0,0,0,25152,0,0,0,25153,0,25152,
+25089,0,0,25217,0,25216,0,0,0,19464,18952,0,18952,0,18440,0,9420,0,18952,0,18440,0,0,17928,
+9417,9416,0,0,9418,0,9417,9416,0,0,0,0,26176,0,18630,0,0,18116,18560,25152,0,0,0,18114,
+0,0,0,18048,0,17536,26176,25152,0,26176,0,17472,0,25152,0,0,8192,0,8192,8192,0,0,0,0,
+8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,25216,0,0,0,0,0,0,0,0,0,0,0,25216,0,0,0,25216,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,25216,0,0,0,25216,0,25216,0,0,0,0,0,0,0,0,25264,25216,0,25216,0,0,25216,
+25216,25232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,0,
+0,0,0,0,0,25216,0,0,0,25217,0,8192,0,0,25216,0,0,0,25216,0,25216,0,0,0,
+0,0,0,0,0,25248,25216,0,25216,0,0,25216,25216,25224,0,0,0,0,0,0,0,0,0,25216,
+0,0,0,0,0,0,0,0,0,0,0,25216,0,0,0,25217,0,8192,25216,0,25216,0,0,25216,
+25216,25216,0,0,0,25248,0,0,0,25248,0,25248,25216,25216,0,25216,0,25216,0,25216,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,0,0,0,0,0,0,25216,
+0,0,0,25216,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,25220,
+0,0,0,0,0,0,0,0,0,0,0,25216,0,0,0,25216,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25220,
+0,0,0,25220,0,25220,0,0,0,0,0,0,0,0,0,25216,0,25216,0,0,25216,25216,25216,0,
+0,0,25216,0,0,0,25216,0,25216,0,0,0,0,0,0,0,0,25232,25216,0,25216,0,0,25216,
+25216,25240,0,0,0,0,0,0,0,0,0,25216,0,0,0,0,0,0,0,0,0,0,0,25216,
+0,0,0,25217,0,8192,25216,0,25216,0,0,25216,25216,25232,0,0,0,25232,0,0,0,25232,0,25232,
+25216,25232,0,25216,0,25216,0,25232,0,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,0,
+0,0,0,0,0,25216,0,0,0,25217,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25220,0,0,0,25221,0,25220,
+0,0,0,0,0,0,0,0,0,25217,0,25216,0,0,25216,25217,0,0,25216,0,25216,0,0,25216,
+25216,25224,0,0,0,25216,0,0,0,25216,0,25216,25216,25224,0,25216,0,25216,0,25224,0,0,0,25216,
+0,0,0,25217,0,25216,0,0,0,0,0,0,0,0,25216,25217,0,25216,0,0,25216,25217,0,0,
+8192,8192,0,8192,0,8192,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,8192,0,8192,8192,0,
+0,0,0,27173,0,10248,0,0,18952,19460,25104,0,0,0,25120,0,0,0,25120,0,25120,10256,25104,0,
+26128,0,9400,0,25104,0,0,0,26144,0,0,0,26160,0,18436,0,0,0,0,0,0,0,0,25120,
+26128,0,9394,0,0,26128,9393,25104,0,10241,25104,0,26113,0,8192,0,25104,0,25120,0,8192,0,0,8192,
+25120,25136,0,0,25104,0,9393,25104,0,0,0,0,0,0,18952,0,0,0,25089,0,9388,0,0,0,
+0,0,0,0,0,25120,25089,0,9386,0,0,25216,25089,0,0,0,0,0,0,0,0,0,0,25120,
+0,0,0,0,0,0,0,0,0,0,0,25120,0,0,0,25121,0,8192,25089,0,8192,0,0,8192,
+25089,0,0,0,0,8192,0,0,0,25121,0,8192,25089,0,0,25217,0,8192,0,0,0,19460,26116,0,
+26116,0,9388,0,9388,0,25120,0,25120,0,0,25120,25120,25120,0,0,8192,0,8192,8192,0,0,0,0,
+18948,0,18436,0,0,17924,9381,9380,0,0,0,25120,0,0,0,25120,0,25120,8192,8192,0,8192,0,8192,
+0,8192,0,0,9382,0,9381,25092,0,0,0,0,25120,25122,0,25121,0,8192,0,25120,0,0,0,0,
+0,8192,0,0,0,0,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,
+26128,0,9370,0,0,9368,9369,25104,0,0,0,0,0,0,0,0,0,25108,0,0,0,0,0,0,
+0,0,0,0,0,25104,0,0,0,25104,0,8192,25092,0,8192,0,0,8192,25092,25108,0,0,0,0,
+0,0,0,0,0,0,9363,25104,0,9361,0,8192,0,25104,0,0,0,0,0,0,0,0,0,25100,
+0,0,0,0,0,0,0,0,0,0,0,25096,0,0,0,25097,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,25093,0,8192,0,0,0,0,0,0,0,0,0,25089,0,8192,0,0,8192,25089,0,0,
+25092,0,25092,0,0,25092,25092,25092,0,0,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,8192,
+0,8192,0,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,8192,0,8192,
+0,0,8192,8192,8192,0,25092,25092,0,25092,0,8192,0,25092,0,0,0,0,0,0,0,0,0,0,
+0,8192,0,8192,8192,0,0,0,0,19480,25104,0,26129,0,18440,0,25104,0,26113,0,18440,0,0,17928,
+18456,25104,0,0,25104,0,26128,25104,0,0,0,0,19095,0,18454,0,0,18068,18452,25104,0,0,0,18066,
+0,0,0,18065,0,17552,18448,25104,0,26128,0,17424,0,25104,0,0,25104,0,9365,25108,0,0,0,0,
+9363,25106,0,25089,0,8192,0,25104,0,0,0,0,0,25104,0,0,0,0,25089,0,18440,0,0,25216,
+25089,0,0,0,0,17928,0,0,0,25089,0,17416,25089,0,0,25217,0,25216,0,0,0,0,0,18054,
+0,0,0,25089,0,17412,0,0,0,0,0,0,0,0,17024,25089,0,17410,0,0,25216,25089,0,0,
+25089,0,0,25217,0,8192,0,0,0,25089,0,8192,0,0,8192,25089,0,0,0,0,0,25217,0,0,
+0,0,0,0,9358,0,9357,25092,0,0,0,0,18440,25090,0,25089,0,17416,0,9352,0,0,0,0,
+0,8192,0,0,0,0,18436,17924,0,17924,0,17412,0,9348,0,18051,0,17538,0,0,17024,17536,17024,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25152,0,0,0,
+0,0,0,0,0,0,0,0,25152,0,0,0,25152,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25152,0,0,0,
+25152,0,25152,0,0,0,0,0,0,0,0,25184,25152,0,25152,0,0,25168,25152,25168,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25152,0,0,0,0,0,0,0,0,0,0,0,25154,
+0,0,0,25153,0,8192,0,0,25152,0,0,0,25152,0,25152,0,0,0,0,0,0,0,0,25184,
+25152,0,25152,0,0,25152,25152,25152,0,0,0,0,0,0,0,0,0,25152,0,0,0,0,0,0,
+0,0,0,0,0,25152,0,0,0,25152,0,8192,25152,0,25152,0,0,25152,25152,25152,0,0,0,25184,
+0,0,0,25184,0,25184,25152,25152,0,25152,0,25152,0,25152,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,25156,0,0,0,0,0,0,0,0,0,0,0,25152,0,0,0,25152,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,25156,0,0,0,0,0,0,
+0,0,0,0,0,25152,0,0,0,25152,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25156,0,0,0,25156,0,25156,
+0,0,0,0,0,0,0,0,0,25152,0,25152,0,0,25152,25152,25152,0,0,0,25152,0,0,0,
+25152,0,25152,0,0,0,0,0,0,0,0,25152,25152,0,25152,0,0,25168,25152,25168,0,0,0,0,
+0,0,0,0,0,25152,0,0,0,0,0,0,0,0,0,0,0,25152,0,0,0,25152,0,8192,
+25152,0,25152,0,0,25168,25152,25168,0,0,0,25152,0,0,0,25152,0,25152,25152,25168,0,25168,0,25168,
+0,25168,0,0,0,0,0,0,0,0,0,25152,0,0,0,0,0,0,0,0,0,0,0,25154,
+0,0,0,25153,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,25154,0,0,0,25153,0,25152,0,0,0,0,0,0,
+0,0,25152,25155,0,25154,0,0,0,25153,0,0,25152,0,25152,0,0,25152,25152,25152,0,0,0,25152,
+0,0,0,25152,0,25152,25152,25152,0,25152,0,25152,0,25152,0,0,0,25152,0,0,0,25152,0,25152,
+0,0,0,0,0,0,0,0,25152,25152,0,25152,0,0,25152,25152,25152,0,8192,8192,0,8192,0,8192,
+0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,8192,0,8192,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,10248,0,0,0,18949,0,9276,0,0,0,0,0,0,0,0,25120,
+26128,0,9274,0,0,25104,9273,25104,0,0,0,0,0,0,0,0,0,17924,0,0,0,0,0,0,
+0,0,0,0,0,9266,0,0,0,9265,0,8192,10241,0,8192,0,0,8192,10241,25104,0,0,0,8192,
+0,0,0,25120,0,8192,9267,25104,0,25104,0,8192,0,25104,0,0,0,0,0,0,0,0,0,9260,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,8192,
+0,0,0,25089,0,8192,0,0,0,0,0,0,0,0,8192,25091,0,8192,0,0,0,25089,0,0,
+18948,0,9262,0,0,9260,18436,17924,0,0,0,25120,0,0,0,25120,0,25120,8192,8192,0,8192,0,8192,
+0,8192,0,0,0,17924,0,0,0,17924,0,17412,0,0,0,0,0,0,0,0,25120,8192,0,8192,
+0,0,8192,8192,8192,0,9255,9254,0,9253,0,8192,0,9252,0,25120,0,8192,0,0,8192,25120,25120,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,
+0,0,0,0,0,9242,0,0,0,9241,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,8192,0,0,0,25092,0,8192,
+0,0,0,0,0,0,0,0,0,9235,0,8192,0,0,8192,9233,25104,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+25089,0,8192,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,8192,0,8192,
+0,0,8192,8192,8192,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,8192,25092,0,8192,0,0,8192,25092,25092,0,0,0,0,0,0,0,
+0,0,0,8192,8192,0,8192,0,8192,0,8192,0,26128,0,10248,0,0,25104,10269,25104,0,0,0,17928,
+0,0,0,17945,0,17416,26128,25104,0,25104,0,25104,0,25104,0,0,0,17942,0,0,0,17941,0,17412,
+0,0,0,0,0,0,0,0,16912,26128,0,9234,0,0,25104,9233,25104,0,9239,25104,0,25104,0,8192,
+0,25104,0,9235,0,8192,0,0,8192,9233,25104,0,0,25104,0,25104,25104,0,0,0,0,0,0,25090,
+0,0,0,25089,0,9228,0,0,0,0,0,0,0,0,16904,25091,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,16900,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,
+25089,0,8192,25091,0,8192,0,0,0,25089,0,0,0,0,8192,0,0,0,25089,0,8192,25091,0,0,
+0,0,0,0,0,0,9231,9230,0,9229,0,9228,0,9228,0,17928,0,17416,0,0,16904,17416,16904,0,
+0,8192,0,8192,8192,0,0,0,0,17924,0,17412,0,0,16900,17412,16900,0,0,0,16898,0,0,0,
+16897,0,16384,8192,8192,0,8192,0,8192,0,8192,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,
+8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,27188,0,19478,0,0,19068,27152,25104,0,
+0,0,25120,0,0,0,25120,0,25120,19474,25104,0,19065,0,18520,0,25104,0,0,0,26144,0,0,0,
+26128,0,9332,0,0,0,0,0,0,0,0,25120,26129,0,18434,0,0,18032,9329,25168,0,27140,25104,0,
+26117,0,18496,0,25104,0,25120,0,25120,0,0,25120,25120,25136,0,0,25104,0,18512,25104,0,0,0,0,
+0,0,26148,0,0,0,25089,0,26116,0,0,0,0,0,0,0,0,25184,25089,0,18434,0,0,18024,
+25089,0,0,0,0,0,0,0,0,0,0,25120,0,0,0,0,0,0,0,0,0,0,0,25120,
+0,0,0,25121,0,8192,25089,0,18496,0,0,17984,25089,0,0,0,0,25184,0,0,0,25185,0,25184,
+25089,0,0,25089,0,17472,0,0,0,19458,18946,0,26116,0,18540,0,8192,0,25120,0,25120,0,0,25120,
+8192,8192,0,0,9322,0,18496,17984,0,0,0,0,18946,0,18434,0,0,18020,8192,8192,0,0,0,25120,
+0,0,0,8192,0,8192,9315,25152,0,17984,0,17472,0,8192,0,0,9318,0,18464,25092,0,0,0,0,
+25120,25122,0,25121,0,25120,0,8192,0,0,0,0,0,9312,0,0,0,0,0,0,25092,0,0,0,
+25092,0,25092,0,0,0,0,0,0,0,0,0,26128,0,10242,0,0,18008,9305,25104,0,0,0,0,
+0,0,0,0,0,25108,0,0,0,0,0,0,0,0,0,0,0,25104,0,0,0,25104,0,8192,
+25092,0,25092,0,0,25092,25092,25108,0,0,0,0,0,0,0,0,0,0,10323,25104,0,18001,0,17472,
+0,25104,0,0,0,0,0,0,0,0,0,25100,0,0,0,0,0,0,0,0,0,0,0,25096,
+0,0,0,25097,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,25093,0,25092,0,0,0,0,0,0,
+0,0,0,25089,0,9282,0,0,16960,25089,0,0,25092,0,25092,0,0,25092,8192,8192,0,0,0,0,
+0,0,0,0,0,0,9291,9290,0,17984,0,17472,0,8192,0,0,0,25092,0,0,0,8192,0,8192,
+0,0,0,0,0,0,0,0,0,9283,0,9282,0,0,16960,8192,8192,0,25092,25092,0,25092,0,25092,
+0,8192,0,0,0,0,0,0,0,0,0,0,0,9282,0,17472,16960,0,0,0,0,19482,25104,0,
+26113,0,18520,0,25104,0,26129,0,18456,0,0,18008,26128,25104,0,0,25104,0,18520,25104,0,0,0,0,
+26113,0,18454,0,0,18004,18448,25168,0,0,0,18002,0,0,0,26128,0,17424,26113,25168,0,26113,0,17488,
+0,25168,0,0,25104,0,18448,25108,0,0,0,0,26128,25106,0,25089,0,9296,0,25104,0,0,0,0,
+0,25104,0,0,0,0,25089,0,18510,0,0,17996,25089,0,0,0,0,25152,0,0,0,25153,0,25152,
+25089,0,0,25089,0,17480,0,0,0,0,0,17990,0,0,0,25089,0,17412,0,0,0,0,0,0,
+0,0,25152,25089,0,17410,0,0,16960,25089,0,0,25089,0,0,25089,0,17472,0,0,0,25153,0,25152,
+0,0,25152,25153,0,0,0,0,0,25089,0,0,0,0,0,0,9294,0,18440,25092,0,0,0,0,
+9291,25090,0,25089,0,17416,0,8192,0,0,0,0,0,9288,0,0,0,0,18434,25152,0,26113,0,17476,
+0,8192,0,17922,0,17410,0,0,16960,8192,8192,0,0,25152,0,17472,25152,0,0,0,0,0,0,0,
+0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,26116,0,0,0,26128,0,9276,0,0,0,0,0,0,0,0,25136,26113,0,18434,0,0,17976,
+9273,25112,0,0,0,0,0,0,0,0,0,9268,0,0,0,0,0,0,0,0,0,0,0,17922,
+0,0,0,25089,0,8192,26132,0,26116,0,0,26116,26128,25104,0,0,0,25136,0,0,0,25136,0,25136,
+18450,25104,0,17969,0,17456,0,25104,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,
+0,0,0,0,0,17922,0,0,0,25089,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25092,0,0,0,25093,0,25092,
+0,0,0,0,0,0,0,0,0,25089,0,17410,0,0,16928,25089,0,0,18946,0,18434,0,0,17964,
+8192,8192,0,0,0,25120,0,0,0,8192,0,8192,18434,25096,0,17961,0,17448,0,8192,0,0,0,17922,
+0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,25089,0,17410,0,0,16928,8192,0,0,
+9255,9254,0,17952,0,17440,0,8192,0,25120,0,25120,0,0,25120,8192,8192,0,0,9250,0,17440,16928,0,
+0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,17922,
+0,0,0,9241,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,
+0,0,0,17939,0,17410,0,0,16912,9233,25104,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,16898,0,0,0,25089,0,8192,0,0,25092,
+0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,17922,0,17410,0,0,16904,8192,8192,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,16898,0,0,0,
+8192,0,8192,25092,0,25092,0,0,25092,8192,8192,0,0,0,0,0,0,0,0,0,0,17410,16898,0,
+16897,0,16384,0,8192,0,26129,0,18450,0,0,17948,26128,25112,0,0,0,25104,0,0,0,25104,0,25104,
+26113,25112,0,26113,0,17432,0,25112,0,0,0,17942,0,0,0,25089,0,9236,0,0,0,0,0,0,
+0,0,25104,25089,0,17410,0,0,16912,25089,0,0,26128,25104,0,26128,0,17424,0,25104,0,25104,0,25104,
+0,0,25104,25104,25104,0,0,25104,0,17424,25104,0,0,0,0,0,0,25092,0,0,0,25093,0,25092,
+0,0,0,0,0,0,0,0,0,25089,0,17410,0,0,16904,25089,0,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,16898,0,0,0,25089,0,8192,25093,0,25092,
+0,0,25092,25093,0,0,0,0,0,0,0,0,0,0,0,25089,0,0,25089,0,16384,0,0,0,
+9231,25096,0,17928,0,17416,0,8192,0,9227,0,9226,0,0,16904,8192,8192,0,0,25096,0,17416,25096,0,
+0,0,0,25089,0,17410,0,0,16900,8192,0,0,0,0,16898,0,0,0,8192,0,8192,25089,0,0,
+25089,0,16384,0,0,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,
+0,0,0,0,8192,0,0,0,0,27172,25104,0,26117,0,18440,0,25104,0,25120,0,25120,0,0,25120,
+25120,25136,0,0,25104,0,18448,25104,0,0,0,0,26160,0,26144,0,0,26144,26128,25104,0,0,0,25120,
+0,0,0,25120,0,25120,26128,25104,0,26128,0,17424,0,25104,0,0,25104,0,26113,25108,0,0,0,0,
+25120,25138,0,25121,0,8192,0,25136,0,0,0,0,0,25104,0,0,0,0,25089,0,18440,0,0,17928,
+25089,0,0,0,0,25120,0,0,0,25121,0,25120,25089,0,0,25089,0,17416,0,0,0,0,0,25120,
+0,0,0,25121,0,25120,0,0,0,0,0,0,0,0,25120,25121,0,25120,0,0,25120,25121,0,0,
+25089,0,0,25089,0,8192,0,0,0,25121,0,8192,0,0,8192,25121,0,0,0,0,0,25089,0,0,
+0,0,0,0,9262,0,26116,25092,0,0,0,0,25120,25122,0,25121,0,25120,0,8192,0,0,0,0,
+0,8192,0,0,0,0,9255,9254,0,26116,0,17412,0,8192,0,25120,0,25120,0,0,25120,8192,8192,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25122,0,25121,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,25092,0,25092,0,0,25092,25092,25108,0,0,0,0,
+0,0,0,0,0,0,26128,25104,0,26128,0,9240,0,25104,0,0,0,25108,0,0,0,25108,0,25108,
+0,0,0,0,0,0,0,0,0,25104,0,25104,0,0,25104,25104,25104,0,25092,25108,0,25092,0,8192,
+0,25108,0,0,0,0,0,0,0,0,0,0,0,25104,0,9233,25104,0,0,0,0,0,0,25100,
+0,0,0,25101,0,25100,0,0,0,0,0,0,0,0,0,25097,0,25096,0,0,25096,25097,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,25093,0,8192,0,0,8192,25093,0,0,0,0,0,0,0,0,0,0,0,25089,0,0,
+25089,0,8192,0,0,0,25092,25092,0,25092,0,25092,0,8192,0,0,0,0,0,0,0,0,0,0,
+0,8192,0,8192,8192,0,0,0,0,25092,0,25092,0,0,25092,8192,8192,0,0,0,0,0,0,0,
+0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,25092,0,25092,25092,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,25104,0,26113,25108,0,0,0,0,
+26113,25106,0,25089,0,17416,0,25104,0,0,0,0,0,25104,0,0,0,0,18454,25104,0,26113,0,17428,
+0,25104,0,26113,0,17426,0,0,16912,17424,25104,0,0,25104,0,17424,25104,0,0,0,0,0,0,0,
+0,25108,0,0,0,0,0,25106,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+25089,0,0,25089,0,17416,0,0,0,25089,0,17416,0,0,16904,25089,0,0,0,0,0,25089,0,0,
+0,0,0,25089,0,17414,0,0,16900,25089,0,0,0,0,16898,0,0,0,25089,0,16384,25089,0,0,
+25089,0,16384,0,0,0,0,0,0,25089,0,0,0,0,0,25089,0,0,25089,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9222,0,17412,25092,0,0,0,0,17410,25090,0,
+25089,0,16384,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20496,27204,0,27140,0,19472,
+0,19664,0,27203,0,10256,0,0,26128,19600,26176,0,0,10272,0,10272,10272,0,0,0,0,27200,0,19472,
+0,0,26128,19472,25152,0,0,0,26128,0,0,0,26192,0,26128,10272,25152,0,10272,0,9456,0,25152,0,
+0,19508,0,19472,25092,0,0,0,0,19457,25090,0,25089,0,9456,0,18576,0,0,0,0,0,10272,0,
+0,0,0,20207,0,19626,0,0,25216,19501,26184,0,0,0,25152,0,0,0,25152,0,25152,19488,18976,0,
+25216,0,25216,0,18464,0,0,0,25120,0,0,0,25120,0,25120,0,0,0,0,0,0,0,0,25184,
+25120,0,25120,0,0,25248,25120,25184,0,19651,26118,0,25216,0,25216,0,18660,0,25152,0,25152,0,0,25280,
+25152,25152,0,0,18464,0,25216,25216,0,0,0,0,0,19524,0,10241,25092,0,0,0,0,19457,25090,0,
+25089,0,8192,0,18560,0,0,0,0,0,9448,0,0,0,0,10241,25152,0,26113,0,8192,0,25152,0,
+26113,0,8192,0,0,8192,9441,25152,0,0,25152,0,9441,25152,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20177,0,19472,
+0,0,26128,19472,26120,0,0,0,26128,0,0,0,26128,0,26128,19472,26120,0,26128,0,26128,0,26120,0,
+0,0,25104,0,0,0,25104,0,25104,0,0,0,0,0,0,0,0,25104,25104,0,25104,0,0,25104,
+25104,25168,0,19521,19158,0,19153,0,9428,0,18640,0,19009,0,9426,0,0,9424,10449,18128,0,0,18640,0,
+18512,18128,0,0,0,0,0,0,25096,0,0,0,25096,0,25096,0,0,0,0,0,0,0,0,25160,
+25096,0,25096,0,0,25224,25096,25096,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,19139,0,18496,0,0,25216,18497,18116,0,0,0,25152,
+0,0,0,25152,0,25152,18627,18114,0,25216,0,25216,0,17600,0,10241,19142,0,18945,0,8192,0,18560,0,
+18945,0,8192,0,0,8192,9417,18048,0,0,18496,0,9417,17984,0,0,0,0,10241,0,8192,0,0,8192,
+9413,25152,0,0,0,8192,0,0,0,9409,0,8192,9411,25152,0,9409,0,8192,0,25152,0,0,18630,0,
+18433,25092,0,0,0,0,18433,25090,0,25089,0,8192,0,17536,0,0,0,0,0,17472,0,0,0,0,
+0,27140,0,27140,25092,0,0,0,0,27139,25090,0,25089,0,26128,0,26176,0,0,0,0,0,8192,0,
+0,0,0,19460,25152,0,27140,0,9428,0,25152,0,26177,0,18448,0,0,26128,26176,25152,0,0,8192,0,
+8192,8192,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19460,26116,0,25216,0,25216,0,18436,0,25152,0,25152,0,0,25280,
+25152,25152,0,0,8192,0,8192,8192,0,0,0,0,18948,0,18436,0,0,25216,18436,25152,0,0,0,25152,
+0,0,0,25152,0,25152,8192,8192,0,8192,0,8192,0,8192,0,0,26116,0,25216,25220,0,0,0,0,
+25152,25154,0,25281,0,25280,0,25152,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25152,0,
+9413,25156,0,0,0,0,26113,25154,0,25089,0,8192,0,25152,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,27149,0,10256,0,0,26128,19457,25096,0,0,0,25104,0,0,0,25104,0,25104,10272,25096,0,
+18976,0,9400,0,25096,0,0,0,26128,0,0,0,25089,0,9396,0,0,0,0,0,0,0,0,25104,
+25089,0,9394,0,0,9392,25089,0,0,19504,26116,0,26132,0,26128,0,18480,0,25104,0,25104,0,0,25104,
+25104,25104,0,0,18464,0,18464,17952,0,0,0,0,0,0,25092,0,0,0,25092,0,25092,0,0,0,
+0,0,0,0,0,0,18976,0,9386,0,0,25216,9385,25096,0,0,0,0,0,0,0,0,0,25124,
+0,0,0,0,0,0,0,0,0,0,0,25120,0,0,0,25121,0,8192,25092,0,25092,0,0,25220,
+25092,25092,0,0,0,0,0,0,0,0,0,0,18464,17952,0,25216,0,25216,0,17440,0,19457,25096,0,
+26113,0,8192,0,25096,0,26113,0,8192,0,0,8192,9385,25096,0,0,25096,0,9385,25096,0,0,0,0,
+25089,0,8192,0,0,8192,25089,0,0,0,0,8192,0,0,0,25089,0,8192,25089,0,0,25089,0,8192,
+0,0,0,0,18464,0,9381,25092,0,0,0,0,9379,25090,0,25089,0,8192,0,9376,0,0,0,0,
+0,17440,0,0,0,0,0,0,26128,0,0,0,26136,0,9372,0,0,0,0,0,0,0,0,25104,
+26120,0,9370,0,0,26128,18433,25096,0,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,0,
+0,0,0,0,0,25104,0,0,0,25105,0,8192,19095,0,18448,0,0,26128,18449,18068,0,0,0,25104,
+0,0,0,25104,0,25104,18451,18066,0,18065,0,17424,0,17552,0,0,0,0,0,0,0,0,0,25100,
+0,0,0,0,0,0,0,0,0,0,0,25096,0,0,0,25096,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,18051,0,17410,0,0,25216,17409,17024,0,
+18945,0,8192,0,0,8192,9357,25096,0,0,0,8192,0,0,0,9353,0,8192,18433,25096,0,17921,0,8192,
+0,25096,0,0,0,8192,0,0,0,25089,0,8192,0,0,0,0,0,0,0,0,8192,25089,0,8192,
+0,0,8192,25089,0,0,18433,18054,0,17921,0,8192,0,17536,0,17921,0,8192,0,0,8192,9345,17024,0,
+0,17538,0,17409,17024,0,0,0,0,10244,25096,0,26116,0,9372,0,25096,0,25104,0,25104,0,0,25104,
+25104,25112,0,0,8192,0,8192,8192,0,0,0,0,25089,0,9366,0,0,9364,25089,0,0,0,0,25104,
+0,0,0,25105,0,25104,8192,0,0,8192,0,8192,0,0,0,0,9366,0,9365,25092,0,0,0,0,
+25104,25106,0,25105,0,25104,0,25104,0,0,0,0,0,8192,0,0,0,0,25092,0,25092,0,0,25220,
+25092,25100,0,0,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,25092,
+0,0,0,25093,0,25092,0,0,0,0,0,0,0,0,0,8192,0,8192,0,0,8192,8192,0,0,
+25092,25092,0,25220,0,25220,0,25092,0,0,0,0,0,0,0,0,0,0,0,8192,0,8192,8192,0,
+0,0,0,0,25096,0,9357,25100,0,0,0,0,9355,25098,0,25089,0,8192,0,25096,0,0,0,0,
+0,8192,0,0,0,0,25089,0,0,25089,0,8192,0,0,0,25089,0,8192,0,0,8192,25089,0,0,
+0,0,0,8192,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,10368,0,10368,25092,0,0,0,0,10368,25090,0,
+25089,0,9400,0,18560,0,0,0,0,0,9400,0,0,0,0,10368,10368,0,10368,0,9396,0,10368,0,
+19072,0,9394,0,0,9392,18560,18048,0,0,9394,0,9393,9392,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19584,19072,0,
+25216,0,25216,0,18560,0,19072,0,9386,0,0,25216,18560,18048,0,0,9386,0,25216,25216,0,0,0,0,
+25120,0,25120,0,0,25248,25120,25120,0,0,0,25120,0,0,0,25120,0,25120,25120,25120,0,25248,0,25248,
+0,25120,0,0,18560,0,25216,25220,0,0,0,0,9379,25090,0,25217,0,8192,0,17536,0,0,0,0,
+0,25216,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,9382,0,9381,25092,0,0,0,0,9379,25090,0,25089,0,8192,
+0,17536,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10368,19072,0,10368,0,9372,0,18560,0,
+10368,0,9370,0,0,9368,10368,18048,0,0,9370,0,9369,9368,0,0,0,0,25104,0,25104,0,0,25104,
+25104,25104,0,0,0,25104,0,0,0,25104,0,25104,25104,25104,0,25104,0,25104,0,25104,0,0,18560,0,
+9365,25092,0,0,0,0,9363,25090,0,25089,0,8192,0,17536,0,0,0,0,0,9360,0,0,0,0,
+25096,0,25096,0,0,25224,25096,25096,0,0,0,25096,0,0,0,25096,0,25096,25096,25096,0,25224,0,25224,
+0,25096,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9351,18048,0,25216,0,8192,0,17536,0,9347,0,8192,0,0,8192,9345,17024,0,
+0,17536,0,25216,25216,0,0,0,0,0,9358,0,9357,25092,0,0,0,0,9355,25090,0,25089,0,8192,
+0,17536,0,0,0,0,0,8192,0,0,0,0,9351,9350,0,9349,0,8192,0,9348,0,9347,0,8192,
+0,0,8192,9345,17024,0,0,8192,0,8192,8192,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9366,0,
+9365,25092,0,0,0,0,18560,25090,0,25089,0,9360,0,17536,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9358,0,25216,25220,0,0,0,0,18560,25090,0,25217,0,25216,0,17536,0,0,0,0,
+0,8192,0,0,0,0,9351,9350,0,25216,0,25216,0,9348,0,18048,0,17536,0,0,25216,17536,17024,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,25090,0,25217,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20021,0,19472,
+0,0,25104,19461,19068,0,0,0,26128,0,0,0,19065,0,18448,10272,18976,0,25104,0,25104,0,18464,0,
+0,0,26128,0,0,0,18997,0,9332,0,0,0,0,0,0,0,0,26128,10272,0,9330,0,0,25104,
+9329,25152,0,19472,26114,0,25104,0,25104,0,18484,0,26130,0,9330,0,0,25104,18449,18032,0,0,18464,0,
+25104,25104,0,0,0,0,0,0,25090,0,0,0,18989,0,18436,0,0,0,0,0,0,0,0,25152,
+25090,0,25090,0,0,0,9321,17952,0,0,0,0,0,0,0,0,0,25120,0,0,0,0,0,0,
+0,0,0,0,0,25122,0,0,0,25120,0,8192,25090,0,25090,0,0,0,18437,18020,0,0,0,25154,
+0,0,0,25152,0,25152,25090,25090,0,0,0,0,0,17440,0,10241,19052,0,10241,0,8192,0,18540,0,
+18945,0,8192,0,0,8192,18433,18024,0,0,9322,0,9321,9320,0,0,0,0,18945,0,8192,0,0,8192,
+18433,25152,0,0,0,8192,0,0,0,17921,0,8192,9315,25152,0,9313,0,8192,0,25152,0,0,18464,0,
+9317,25092,0,0,0,0,9315,25090,0,25089,0,8192,0,17440,0,0,0,0,0,9312,0,0,0,0,
+0,0,26128,0,0,0,18973,0,9308,0,0,0,0,0,0,0,0,26128,26128,0,9306,0,0,25104,
+18433,26120,0,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,0,0,0,0,0,0,25104,
+0,0,0,25104,0,8192,19027,0,9302,0,0,25104,18433,18004,0,0,0,9298,0,0,0,18001,0,9296,
+18449,18002,0,25104,0,25104,0,17488,0,0,0,0,0,0,0,0,0,25096,0,0,0,0,0,0,
+0,0,0,0,0,25098,0,0,0,25096,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,17989,0,9284,
+0,0,0,0,0,0,0,0,25152,25090,0,25090,0,0,0,17409,16960,0,18945,0,8192,0,0,8192,
+18433,17996,0,0,0,8192,0,0,0,17921,0,8192,9291,17984,0,9289,0,8192,0,17472,0,0,0,8192,
+0,0,0,17921,0,8192,0,0,0,0,0,0,0,0,8192,9283,0,8192,0,0,8192,9281,25152,0,
+18433,17990,0,17921,0,8192,0,17476,0,17921,0,8192,0,0,8192,17409,16960,0,0,17472,0,9281,16960,0,
+0,0,0,10244,27140,0,25104,0,25104,0,18436,0,26130,0,26128,0,0,25104,18457,26176,0,0,8192,0,
+8192,8192,0,0,0,0,27140,0,9302,0,0,25104,18436,25152,0,0,0,26128,0,0,0,26176,0,17424,
+8192,8192,0,8192,0,8192,0,8192,0,0,9302,0,25104,25108,0,0,0,0,26128,25090,0,25105,0,25104,
+0,17424,0,0,0,0,0,8192,0,0,0,0,25090,0,25090,0,0,0,18436,17924,0,0,0,25154,
+0,0,0,25152,0,25152,8192,8192,0,0,0,0,0,8192,0,0,0,25090,0,0,0,17924,0,17412,
+0,0,0,0,0,0,0,0,25152,8192,0,8192,0,0,0,8192,8192,0,25090,25090,0,0,0,0,
+0,17412,0,25154,0,25154,0,0,0,25152,25152,0,0,8192,0,0,0,0,0,0,0,0,9294,0,
+9293,25092,0,0,0,0,9291,25090,0,25089,0,8192,0,17416,0,0,0,0,0,8192,0,0,0,0,
+9287,25152,0,9285,0,8192,0,25152,0,26113,0,8192,0,0,8192,17409,25152,0,0,8192,0,8192,8192,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,26128,0,0,0,18949,0,9276,0,0,0,0,0,0,0,0,25104,
+10272,0,9274,0,0,25104,9273,25096,0,0,0,0,0,0,0,0,0,9268,0,0,0,0,0,0,
+0,0,0,0,0,9266,0,0,0,25089,0,8192,26128,0,26128,0,0,25104,10293,17972,0,0,0,25104,
+0,0,0,25104,0,25104,10272,17952,0,25104,0,25104,0,17440,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,9257,0,8192,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,25094,
+0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,25090,0,25090,0,0,0,9249,16928,0,
+18945,0,8192,0,0,8192,18433,25096,0,0,0,8192,0,0,0,17921,0,8192,9259,25096,0,9257,0,8192,
+0,25096,0,0,0,8192,0,0,0,25089,0,8192,0,0,0,0,0,0,0,0,8192,25089,0,8192,
+0,0,8192,25089,0,0,9255,17952,0,9253,0,8192,0,17440,0,9251,0,8192,0,0,8192,9249,16928,0,
+0,17440,0,9249,16928,0,0,0,0,0,0,0,0,0,0,0,0,9244,0,0,0,0,0,0,
+0,0,0,0,0,9242,0,0,0,17921,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,26128,0,0,0,17941,0,9236,
+0,0,0,0,0,0,0,0,25104,17939,0,9234,0,0,25104,17409,16912,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,
+16897,0,8192,0,0,8192,0,0,0,17921,0,8192,0,0,0,0,0,0,0,0,8192,17921,0,8192,
+0,0,8192,17409,25096,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,25089,0,8192,17921,0,8192,0,0,8192,17409,16900,0,0,0,8192,0,0,0,
+16897,0,8192,17409,16898,0,16897,0,8192,0,16384,0,10244,0,9246,0,0,25104,10244,25096,0,0,0,25104,
+0,0,0,25104,0,25104,8192,8192,0,8192,0,8192,0,8192,0,0,0,9238,0,0,0,25089,0,9236,
+0,0,0,0,0,0,0,0,25104,8192,0,8192,0,0,8192,8192,0,0,9239,9238,0,25104,0,25104,
+0,9236,0,25104,0,25104,0,0,25104,25104,25104,0,0,8192,0,8192,8192,0,0,0,0,0,0,25094,
+0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,0,8192,0,8192,0,0,0,8192,8192,0,
+0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+8192,0,8192,25094,0,25094,0,0,0,25092,25092,0,0,0,0,0,0,0,0,0,0,8192,8192,0,
+0,0,0,0,8192,0,9231,25096,0,9229,0,8192,0,25096,0,9227,0,8192,0,0,8192,9225,25096,0,
+0,8192,0,8192,8192,0,0,0,0,25089,0,8192,0,0,8192,25089,0,0,0,0,8192,0,0,0,
+25089,0,8192,8192,0,0,8192,0,8192,0,0,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,
+8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,19472,26114,0,25104,0,25104,0,18484,0,
+26114,0,9274,0,0,25104,18457,17976,0,0,9274,0,25104,25104,0,0,0,0,26128,0,26128,0,0,25104,
+18452,17972,0,0,0,26128,0,0,0,17969,0,17424,9267,9266,0,25104,0,25104,0,9264,0,0,26114,0,
+25104,25108,0,0,0,0,18433,25090,0,25105,0,8192,0,17456,0,0,0,0,0,25104,0,0,0,0,
+25090,0,25090,0,0,0,18477,17964,0,0,0,25090,0,0,0,17961,0,17416,25090,25090,0,0,0,0,
+0,17440,0,0,0,25122,0,0,0,25120,0,25120,0,0,0,0,0,0,0,0,25120,25122,0,25122,
+0,0,0,25120,25120,0,25090,25090,0,0,0,0,0,17444,0,25090,0,8192,0,0,0,17409,16928,0,
+0,25090,0,0,0,0,0,0,0,0,18436,0,9261,25092,0,0,0,0,18433,25090,0,25089,0,8192,
+0,17448,0,0,0,0,0,8192,0,0,0,0,9255,17924,0,9253,0,8192,0,17412,0,17921,0,8192,
+0,0,8192,17409,16928,0,0,8192,0,8192,8192,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26128,0,9246,0,0,25104,
+18449,17948,0,0,0,9242,0,0,0,17945,0,9240,26128,26128,0,25104,0,25104,0,17424,0,0,0,25104,
+0,0,0,25104,0,25104,0,0,0,0,0,0,0,0,25104,25104,0,25104,0,0,25104,25104,25104,0,
+18433,26114,0,25104,0,8192,0,17428,0,17921,0,8192,0,0,8192,17409,16912,0,0,17424,0,25104,25104,0,
+0,0,0,0,0,25098,0,0,0,25096,0,25096,0,0,0,0,0,0,0,0,25096,25098,0,25098,
+0,0,0,25096,25096,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,25090,0,8192,0,0,0,17409,16900,0,0,0,8192,0,0,0,
+16897,0,8192,25090,25090,0,0,0,0,0,16384,0,9231,17924,0,9229,0,8192,0,17412,0,17921,0,8192,
+0,0,8192,17409,16904,0,0,8192,0,8192,8192,0,0,0,0,9223,0,8192,0,0,8192,9221,16900,0,
+0,0,8192,0,0,0,16897,0,8192,8192,8192,0,8192,0,8192,0,8192,0,0,17412,0,9221,25092,0,
+0,0,0,17409,25090,0,25089,0,8192,0,16384,0,0,0,0,0,8192,0,0,0,0,0,18436,0,
+25104,25108,0,0,0,0,26114,25090,0,25105,0,25104,0,17432,0,0,0,0,0,8192,0,0,0,0,
+18436,17924,0,25104,0,25104,0,17412,0,26114,0,17424,0,0,25104,17425,16912,0,0,8192,0,8192,8192,0,
+0,0,0,0,0,0,0,25108,0,0,0,0,0,25090,0,25105,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,25090,25090,0,0,0,0,0,17412,0,25090,0,25090,0,0,0,17417,16904,0,
+0,8192,0,0,0,0,0,0,0,25090,0,25090,0,0,0,17412,16900,0,0,0,25090,0,0,0,
+16897,0,16384,8192,8192,0,0,0,0,0,8192,0,0,25090,0,0,0,0,0,0,0,25090,25090,0,
+0,0,0,0,16384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17412,0,9221,25092,0,
+0,0,0,17409,25090,0,25089,0,8192,0,16384,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,27200,0,19520,25092,0,0,0,0,10304,25090,0,25089,0,9336,0,9336,0,0,0,0,0,9336,0,
+0,0,0,27200,25152,0,27200,0,9332,0,25152,0,26176,0,9330,0,0,9328,9329,25152,0,0,25152,0,
+9329,25152,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19520,26176,0,19008,0,18496,0,26176,0,25152,0,25152,0,0,25152,
+25152,25152,0,0,9322,0,9321,9320,0,0,0,0,25120,0,25120,0,0,25120,25120,25184,0,0,0,25184,
+0,0,0,25184,0,25184,25120,25184,0,25120,0,25120,0,25184,0,0,18496,0,18496,25092,0,0,0,0,
+25152,25154,0,25153,0,25152,0,25152,0,0,0,0,0,9312,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25152,0,
+9317,25156,0,0,0,0,9315,25154,0,25089,0,8192,0,8192,0,0,0,0,0,25152,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,10304,27200,0,27200,0,9308,0,9308,0,10304,0,9306,0,0,9304,9305,9304,0,0,18496,0,
+18496,17984,0,0,0,0,25104,0,25104,0,0,25104,25104,25168,0,0,0,25104,0,0,0,25104,0,25104,
+25104,25168,0,25104,0,25104,0,25168,0,0,18496,0,18496,25092,0,0,0,0,10304,25090,0,25089,0,9296,
+0,9296,0,0,0,0,0,17472,0,0,0,0,25096,0,25096,0,0,25096,25096,25096,0,0,0,25160,
+0,0,0,25160,0,25160,25096,25096,0,25096,0,25096,0,25096,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18496,17984,0,17984,0,17472,
+0,17472,0,25152,0,25152,0,0,25152,25152,25152,0,0,17472,0,17472,16960,0,0,0,0,0,9294,0,
+9293,25092,0,0,0,0,9291,25090,0,25089,0,8192,0,8192,0,0,0,0,0,17472,0,0,0,0,
+9287,25152,0,9285,0,8192,0,8192,0,9283,0,8192,0,0,8192,8192,8192,0,0,25152,0,9281,25152,0,
+0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25152,0,9301,25156,0,0,0,0,26176,25154,0,25089,0,9296,
+0,25152,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9294,0,9293,25092,0,0,0,0,
+25152,25154,0,25153,0,25152,0,25152,0,0,0,0,0,8192,0,0,0,0,9287,25152,0,9285,0,9284,
+0,25152,0,25152,0,25152,0,0,25152,25152,25152,0,0,8192,0,8192,8192,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,25154,0,25153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25156,0,0,0,0,0,25154,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,27145,25096,0,26117,0,18448,0,25096,0,25104,0,25104,0,0,25104,
+25104,25112,0,0,25096,0,18464,25096,0,0,0,0,25089,0,26128,0,0,26128,25089,0,0,0,0,25104,
+0,0,0,25105,0,25104,25089,0,0,25089,0,9264,0,0,0,0,26116,0,26116,25092,0,0,0,0,
+25104,25106,0,25105,0,25104,0,25104,0,0,0,0,0,17440,0,0,0,0,25092,0,25092,0,0,25092,
+25092,25100,0,0,0,0,0,0,0,0,0,0,18464,25096,0,17952,0,17440,0,25096,0,0,0,25124,
+0,0,0,25125,0,25124,0,0,0,0,0,0,0,0,0,25121,0,25120,0,0,25120,25121,0,0,
+25092,25092,0,25092,0,25092,0,25092,0,0,0,0,0,0,0,0,0,0,0,17440,0,17440,16928,0,
+0,0,0,0,25096,0,26113,25100,0,0,0,0,9259,25098,0,25089,0,8192,0,8192,0,0,0,0,
+0,25096,0,0,0,0,25089,0,0,25089,0,8192,0,0,0,25089,0,8192,0,0,8192,8192,0,0,
+0,0,0,25089,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,26136,0,26128,0,0,26128,26128,25096,0,0,0,25104,
+0,0,0,25104,0,25104,26120,25096,0,26120,0,17424,0,25096,0,0,0,25104,0,0,0,25105,0,25104,
+0,0,0,0,0,0,0,0,25104,25105,0,25104,0,0,25104,25105,0,0,18451,26116,0,26116,0,17424,
+0,17424,0,25104,0,25104,0,0,25104,25104,25104,0,0,17426,0,17425,16912,0,0,0,0,0,0,25100,
+0,0,0,25100,0,25100,0,0,0,0,0,0,0,0,0,25096,0,25096,0,0,25096,25096,25096,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,25092,0,25092,0,0,25092,25092,25092,0,0,0,0,0,0,0,0,0,0,17411,16898,0,
+16897,0,16384,0,16384,0,9231,25096,0,26113,0,8192,0,8192,0,9227,0,8192,0,0,8192,8192,8192,0,
+0,25096,0,17409,25096,0,0,0,0,25089,0,8192,0,0,8192,8192,0,0,0,0,8192,0,0,0,
+8192,0,8192,25089,0,0,25089,0,8192,0,0,0,0,17410,0,17409,25092,0,0,0,0,9219,25090,0,
+25089,0,8192,0,8192,0,0,0,0,0,16384,0,0,0,0,0,25096,0,26116,25100,0,0,0,0,
+25104,25114,0,25105,0,25104,0,25112,0,0,0,0,0,8192,0,0,0,0,25089,0,0,25089,0,9236,
+0,0,0,25105,0,25104,0,0,25104,25105,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,25106,0,25105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+25092,25100,0,25092,0,25092,0,25100,0,0,0,0,0,0,0,0,0,0,0,8192,0,8192,8192,0,
+0,0,0,25093,0,25092,0,0,25092,25093,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,
+8192,0,8192,0,0,0,0,25092,0,25092,25092,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,25100,0,0,0,0,0,25098,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25089,0,0,0,0,0,25089,0,0,
+25089,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+8192,8192,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,
+0,8192,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,8192,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+8192,8192,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,
+8192,8192,0,8192,0,8192,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,8192,0,8192,8192,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,8192,0,8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,
+8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,8192,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,8192,8192,0,
+0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,8192,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,8192,8192,0,0,0,0,8192,8192,0,
+8192,0,8192,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,
+},
+{
+21503,20496,0,20629,0,27224,0,20312,0,20496,0,27464,0,0,27208,20336,19472,0,0,27488,0,27440,27424,0,
+0,0,0,20593,0,27158,0,0,19632,27153,10304,0,0,0,19504,0,0,0,19472,0,26128,27409,10304,0,
+27392,0,26384,0,10304,0,0,20246,0,27153,10244,0,0,0,0,27137,10242,0,27137,0,25152,0,26128,0,
+0,0,0,0,26160,0,0,0,0,20805,0,20462,0,0,19584,20333,10496,0,0,0,19520,0,0,0,
+10304,0,19008,20459,19712,0,19584,0,19072,0,19200,0,0,0,19488,0,0,0,10272,0,25092,0,0,0,
+0,0,0,0,0,9696,19488,0,25090,0,0,9696,25089,9696,0,20423,10496,0,10368,0,25152,0,19200,0,
+10304,0,25152,0,0,25152,19008,9696,0,0,19200,0,19072,9696,0,0,0,0,0,20462,0,27501,19460,0,
+0,0,0,20459,19458,0,19457,0,25344,0,25216,0,0,0,0,0,25152,0,0,0,0,27591,19520,0,
+19525,0,25344,0,25216,0,19651,0,25344,0,0,25344,25216,25216,0,0,25152,0,25152,25152,0,0,0,0,
+0,0,0,0,25120,0,0,0,0,0,25120,0,25120,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20764,0,27220,0,0,27200,27156,19472,0,0,0,10496,0,0,0,10496,0,10496,27155,19480,0,
+19608,0,26192,0,26128,0,0,0,27152,0,0,0,27152,0,25092,0,0,0,0,0,0,0,0,9680,
+27152,0,25090,0,0,26128,25089,9680,0,20439,19716,0,19716,0,25152,0,19348,0,19712,0,25152,0,0,25152,
+27392,18688,0,0,19410,0,26176,18832,0,0,0,0,0,0,19464,0,0,0,10248,0,25092,0,0,0,
+0,0,0,0,0,9672,19464,0,25090,0,0,9672,25089,9672,0,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,19781,0,25152,0,0,25152,
+26113,18688,0,0,0,25152,0,0,0,9665,0,25152,26113,18688,0,18560,0,25152,0,18176,0,27591,19846,0,
+19717,0,25344,0,25216,0,19712,0,25344,0,0,25344,25216,25216,0,0,25152,0,25152,25152,0,0,0,0,
+27591,0,25344,0,0,25344,25216,25216,0,0,0,25344,0,0,0,25216,0,25472,25152,25152,0,25152,0,25408,
+0,25280,0,0,19334,0,26177,18436,0,0,0,0,19200,9666,0,9665,0,25408,0,25216,0,0,0,0,
+0,25152,0,0,0,0,0,27140,0,27156,27140,0,0,0,0,20051,10242,0,10241,0,26136,0,26128,0,
+0,0,0,0,25344,0,0,0,0,20439,19520,0,19521,0,26368,0,27200,0,19521,0,19410,0,0,18640,
+19153,18496,0,0,25344,0,25344,25344,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,25104,0,
+25104,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,20423,10496,0,10368,0,19072,0,19200,0,
+10304,0,19008,0,0,9672,19008,9672,0,0,25344,0,25344,25344,0,0,0,0,19781,0,26116,0,0,18560,
+26116,9668,0,0,0,18496,0,0,0,18496,0,17984,25344,25344,0,25344,0,25344,0,25344,0,0,10496,0,
+10368,9668,0,0,0,0,10304,9666,0,9665,0,25152,0,9664,0,0,0,0,0,25344,0,0,0,0,
+0,0,0,0,25096,0,0,0,0,0,25096,0,25096,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,19008,0,26372,9668,0,0,0,0,19139,9666,0,18433,0,25344,0,25216,0,0,0,0,
+0,25408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,20496,0,27398,0,0,19600,27137,10248,0,0,0,10256,0,0,0,
+19472,0,26128,27393,10248,0,19856,0,26368,0,10248,0,0,0,27142,0,0,0,27137,0,25092,0,0,0,
+0,0,0,0,0,26128,27137,0,25090,0,0,26368,25089,8192,0,20372,19472,0,19472,0,26128,0,26128,0,
+19472,0,26128,0,0,26128,26128,26128,0,0,26144,0,26144,26144,0,0,0,0,0,0,19460,0,0,0,
+10244,0,25092,0,0,0,0,0,0,0,0,8192,19713,0,25090,0,0,18560,25089,9640,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+10244,0,18948,0,0,9636,18948,9636,0,0,0,8192,0,0,0,8192,0,8192,19331,18688,0,18560,0,18048,
+0,18176,0,20399,19464,0,19501,0,25344,0,25216,0,19626,0,25344,0,0,25344,25216,25216,0,0,18952,0,
+26400,18440,0,0,0,0,19457,0,25344,0,0,25344,25216,8192,0,0,0,25344,0,0,0,25216,0,25472,
+26113,8192,0,18433,0,25344,0,8192,0,0,25120,0,25120,25120,0,0,0,0,25120,25120,0,25120,0,25376,
+0,25248,0,0,0,0,0,25120,0,0,0,0,0,0,19460,0,0,0,19472,0,25092,0,0,0,
+0,0,0,0,0,9624,19481,0,25090,0,0,18576,25089,10248,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,19716,0,19204,0,0,10644,
+19348,18704,0,0,0,9618,0,0,0,9617,0,9616,19347,18832,0,18832,0,18320,0,18320,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,18436,0,0,0,18436,0,25092,0,0,0,0,0,0,0,0,8192,18819,0,25090,
+0,0,17536,25089,17664,0,19846,0,25344,0,0,25344,25216,25216,0,0,0,25344,0,0,0,25216,0,25472,
+26115,18440,0,18825,0,25344,0,25216,0,0,0,25344,0,0,0,25216,0,25476,0,0,0,0,0,0,
+0,0,25472,26113,0,25346,0,0,25344,25217,8192,0,19334,18822,0,18692,0,25344,0,25216,0,18688,0,25344,
+0,0,25344,25216,25216,0,0,18306,0,18305,17792,0,0,0,0,27392,10248,0,19472,0,26384,0,10248,0,
+19472,0,26128,0,0,26128,26128,9624,0,0,25344,0,25344,25344,0,0,0,0,19457,0,26372,0,0,26368,
+27137,8192,0,0,0,18448,0,0,0,9617,0,26128,25344,8192,0,25344,0,25344,0,8192,0,0,25104,0,
+25104,25104,0,0,0,0,25104,25104,0,25104,0,25104,0,25104,0,0,0,0,0,25360,0,0,0,0,
+10244,0,26116,0,0,9612,26116,9612,0,0,0,8192,0,0,0,8192,0,8192,25344,25344,0,25344,0,25344,
+0,25344,0,0,0,26116,0,0,0,9605,0,25092,0,0,0,0,0,0,0,0,8192,25344,0,25346,
+0,0,25344,25345,8192,0,10244,9606,0,9605,0,9604,0,9604,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,25344,0,25344,25344,0,0,0,0,0,25096,0,25096,25096,0,0,0,0,25096,25096,0,25096,0,25352,
+0,25224,0,0,0,0,0,25352,0,0,0,0,18945,8192,0,18433,0,25344,0,8192,0,18433,0,25344,
+0,0,25344,25216,8192,0,0,8192,0,25344,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27524,0,27409,10244,0,
+0,0,0,27393,10242,0,27137,0,25096,0,26240,0,0,0,0,0,25104,0,0,0,0,27536,27520,0,
+27392,0,26384,0,26256,0,19760,0,26368,0,0,26368,26240,26240,0,0,25104,0,25104,25104,0,0,0,0,
+0,0,0,0,10244,0,0,0,0,0,10242,0,25089,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20399,19712,0,19584,0,25096,0,19200,0,19713,0,25096,0,0,25096,19241,18688,0,0,26368,0,
+19072,9640,0,0,0,0,19488,0,18976,0,0,9636,18976,9636,0,0,0,18464,0,0,0,18464,0,17952,
+18976,9634,0,9633,0,9632,0,9632,0,0,19200,0,25089,9636,0,0,0,0,25089,9634,0,25089,0,0,
+0,18176,0,0,0,0,0,9632,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,18946,0,
+26113,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,
+26496,18434,0,18433,0,25344,0,25216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,27409,19712,0,
+27393,0,25096,0,26256,0,27392,0,25096,0,0,25096,27392,18688,0,0,25104,0,25104,25104,0,0,0,0,
+27152,0,26128,0,0,26128,26128,26128,0,0,0,9618,0,0,0,9617,0,9616,25104,25104,0,25104,0,25104,
+0,25104,0,0,19204,0,25089,10244,0,0,0,0,25089,9618,0,25089,0,0,0,18176,0,0,0,0,
+0,25104,0,0,0,0,19464,0,25096,0,0,25096,18952,9612,0,0,0,25096,0,0,0,9609,0,25096,
+18952,9610,0,9609,0,25096,0,9608,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,
+0,0,8192,8192,0,8192,0,0,8192,8192,8192,0,25089,18688,0,25089,0,0,0,18176,0,25089,0,0,
+0,0,0,25089,17664,0,0,18176,0,25089,9600,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,
+26368,9610,0,9609,0,25352,0,25216,0,0,0,0,0,0,0,0,0,0,25092,25092,0,25092,0,25348,
+0,25220,0,26368,0,25344,0,0,25344,25216,25216,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,9602,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,26116,0,0,0,0,0,18946,0,27137,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,26372,0,26372,26116,0,0,0,0,19347,18434,0,18433,0,26368,0,26240,0,0,0,0,
+0,25360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,26368,0,19072,9612,0,0,0,0,19331,9610,0,9609,0,25096,
+0,18176,0,0,0,0,0,25344,0,0,0,0,26368,26368,0,18560,0,18048,0,26368,0,18819,0,18306,
+0,0,17536,18305,17664,0,0,25344,0,25344,25344,0,0,0,0,0,0,0,0,9604,0,0,0,0,
+0,9602,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,17922,0,17921,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20818,0,27220,0,0,27152,20349,19776,0,0,0,19520,0,0,0,19776,0,19264,27409,19712,0,
+27152,0,26128,0,19264,0,0,0,27140,0,0,0,19776,0,25092,0,0,0,0,0,0,0,0,10608,
+27393,0,25090,0,0,26128,25089,10304,0,27216,19472,0,27152,0,25152,0,19312,0,19472,0,25152,0,0,25152,
+19312,18704,0,0,26160,0,26128,26128,0,0,0,0,0,0,19458,0,0,0,19781,0,25092,0,0,0,
+0,0,0,0,0,18496,19458,0,25090,0,0,8192,25089,18688,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,10242,0,25152,0,0,8192,
+26113,18688,0,0,0,25152,0,0,0,18496,0,25152,18946,9570,0,8192,0,8192,0,18176,0,27501,19816,0,
+27501,0,25344,0,19304,0,19816,0,25344,0,0,25344,19304,18792,0,0,25152,0,25152,25152,0,0,0,0,
+19777,0,25344,0,0,25344,26117,18496,0,0,0,25344,0,0,0,18752,0,25344,25152,25152,0,25152,0,25408,
+0,25152,0,0,25120,0,25120,25120,0,0,0,0,25120,25120,0,25120,0,25440,0,25120,0,0,0,0,
+0,25184,0,0,0,0,0,0,27204,0,0,0,19776,0,25092,0,0,0,0,0,0,0,0,10496,
+27137,0,25090,0,0,26128,25089,10584,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,
+0,0,0,0,0,25090,0,0,0,25089,0,0,19716,0,25152,0,0,25152,26113,18688,0,0,0,25152,
+0,0,0,18688,0,25152,26177,18704,0,18448,0,25152,0,18256,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25152,
+0,0,0,26113,0,25156,0,0,0,0,0,0,0,0,25152,18434,0,25154,0,0,8192,25089,17664,0,
+19780,0,25344,0,0,25344,26117,18752,0,0,0,25344,0,0,0,18688,0,25344,25152,25152,0,25152,0,25408,
+0,25152,0,0,0,25344,0,0,0,26117,0,25348,0,0,0,0,0,0,0,0,25344,25152,0,25410,
+0,0,25408,25153,25152,0,26177,18692,0,26177,0,25408,0,18244,0,18688,0,25408,0,0,25408,18176,17664,0,
+0,25152,0,25152,25152,0,0,0,0,27408,19472,0,27152,0,26128,0,19288,0,19472,0,26136,0,0,26128,
+19288,18512,0,0,25344,0,25344,25344,0,0,0,0,19521,0,26372,0,0,18448,26116,18496,0,0,0,18512,
+0,0,0,18496,0,18256,25344,25344,0,25344,0,25344,0,25344,0,0,25104,0,25104,25104,0,0,0,0,
+25104,25104,0,25104,0,25168,0,25104,0,0,0,0,0,25360,0,0,0,0,10242,0,18946,0,0,8192,
+26116,18688,0,0,0,9546,0,0,0,18496,0,17984,25344,25344,0,8192,0,8192,0,25344,0,0,0,18434,
+0,0,0,26116,0,25092,0,0,0,0,0,0,0,0,17472,25344,0,25346,0,0,8192,25345,25344,0,
+10242,9542,0,8192,0,8192,0,18176,0,9539,0,25152,0,0,8192,17984,9536,0,0,25344,0,8192,8192,0,
+0,0,0,0,25096,0,25096,25096,0,0,0,0,25096,25096,0,25096,0,25352,0,25096,0,0,0,0,
+0,25416,0,0,0,0,26372,18496,0,26372,0,25344,0,17984,0,18497,0,25344,0,0,25344,18241,17472,0,
+0,25408,0,25408,25408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,10496,0,0,0,19712,0,25092,0,0,0,
+0,0,0,0,0,9528,27392,0,25090,0,0,9528,25089,9528,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,10496,0,10496,0,0,9524,
+27392,18688,0,0,0,9522,0,0,0,9521,0,9520,27392,18688,0,9521,0,9520,0,18176,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9510,0,0,0,9509,0,25092,0,0,0,0,0,0,0,0,8192,9507,0,25090,
+0,0,8192,25089,17664,0,19712,0,25344,0,0,25344,19200,9516,0,0,0,25344,0,0,0,18688,0,25344,
+26368,9514,0,26368,0,25344,0,9512,0,0,0,25344,0,0,0,9509,0,25348,0,0,0,0,0,0,
+0,0,25344,9507,0,25346,0,0,25344,25089,8192,0,25120,25120,0,25120,0,25376,0,25120,0,25120,0,25376,
+0,0,25376,25120,25120,0,0,25120,0,25120,25120,0,0,0,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10496,
+0,0,0,18688,0,25092,0,0,0,0,0,0,0,0,9488,18688,0,25090,0,0,9488,25089,17664,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,
+0,0,25090,0,0,0,25089,0,0,0,0,25344,0,0,0,18688,0,25348,0,0,0,0,0,0,
+0,0,25344,18688,0,25346,0,0,25344,25089,9480,0,0,0,0,0,0,0,0,0,25348,0,0,0,
+0,0,0,0,0,0,0,0,25346,0,0,0,25089,0,0,18688,0,25344,0,0,25344,18176,17664,0,
+0,0,25344,0,0,0,17664,0,25344,18176,17664,0,17664,0,25344,0,17152,0,27392,0,26368,0,0,9500,
+27392,9500,0,0,0,9498,0,0,0,9497,0,9496,25344,25344,0,25344,0,25344,0,25344,0,0,0,26368,
+0,0,0,9493,0,25092,0,0,0,0,0,0,0,0,9488,25344,0,25346,0,0,25344,25345,8192,0,
+25104,25104,0,25104,0,25104,0,25104,0,25104,0,25104,0,0,25104,25104,25104,0,0,25360,0,25360,25360,0,
+0,0,0,0,0,9486,0,0,0,9485,0,25092,0,0,0,0,0,0,0,0,8192,25344,0,25346,
+0,0,8192,25345,25344,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,
+0,0,25346,0,0,0,25345,0,0,9479,0,9478,0,0,8192,9477,9476,0,0,0,8192,0,0,0,
+8192,0,8192,25344,25344,0,8192,0,8192,0,25344,0,25096,25096,0,25096,0,25352,0,25096,0,25096,0,25352,
+0,0,25352,25096,25096,0,0,25352,0,25352,25352,0,0,0,0,9479,0,25344,0,0,25344,9477,8192,0,
+0,0,25344,0,0,0,9473,0,25344,25344,8192,0,25344,0,25344,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27161,19474,0,
+27152,0,25096,0,19260,0,19475,0,25096,0,0,25096,19257,18736,0,0,25104,0,25104,25104,0,0,0,0,
+19506,0,26132,0,0,26128,26116,18736,0,0,0,18480,0,0,0,18736,0,18224,25104,25104,0,25104,0,25104,
+0,25104,0,0,26128,0,25089,9524,0,0,0,0,25089,10242,0,25089,0,0,0,18224,0,0,0,0,
+0,25104,0,0,0,0,19458,0,25096,0,0,8192,26113,18688,0,0,0,25096,0,0,0,18729,0,25096,
+18946,9514,0,8192,0,8192,0,18176,0,0,0,9510,0,0,0,18464,0,25092,0,0,0,0,0,0,
+0,0,17440,9507,0,25090,0,0,8192,25089,9504,0,25089,9510,0,8192,0,0,0,18176,0,25089,0,0,
+0,0,0,25089,17664,0,0,9506,0,8192,8192,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,
+26121,18434,0,26113,0,25352,0,18216,0,0,0,0,0,0,0,0,0,0,25092,25092,0,25092,0,25348,
+0,25092,0,18723,0,25344,0,0,25344,18209,17696,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25124,0,0,0,0,0,25120,0,25121,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+27137,0,25096,0,0,25096,26117,18704,0,0,0,25096,0,0,0,18688,0,25096,25104,25104,0,25104,0,25112,
+0,25104,0,0,0,26128,0,0,0,18448,0,25092,0,0,0,0,0,0,0,0,9488,25104,0,25106,
+0,0,25104,25105,25104,0,25089,10518,0,25089,0,0,0,18196,0,25089,0,0,0,0,0,25089,17664,0,
+0,25104,0,25105,25104,0,0,0,0,0,0,25096,0,0,0,18440,0,25100,0,0,0,0,0,0,
+0,0,25096,9483,0,25098,0,0,8192,25089,9480,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,25089,0,0,0,0,0,25089,17664,0,
+0,0,0,0,0,0,25089,0,0,25089,9474,0,8192,0,0,0,17152,0,25092,25092,0,25092,0,25356,
+0,25092,0,18688,0,25352,0,0,25352,18176,17664,0,0,0,0,0,0,0,0,0,0,25092,0,25348,
+0,0,25348,25092,25092,0,0,0,25344,0,0,0,17664,0,25344,0,0,0,0,0,0,0,0,0,
+0,25092,0,25093,25092,0,0,0,0,25089,9474,0,25089,0,0,0,17152,0,0,0,0,0,0,0,
+0,0,0,0,26132,0,26128,9500,0,0,0,0,26120,18434,0,9497,0,25096,0,18200,0,0,0,0,
+0,25360,0,0,0,0,26116,26116,0,18448,0,26128,0,26116,0,18451,0,18194,0,0,17424,18193,17680,0,
+0,25360,0,25360,25360,0,0,0,0,0,0,0,0,25104,0,0,0,0,0,25104,0,25105,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,18946,9486,0,8192,0,8192,0,18176,0,18434,0,25096,
+0,0,8192,18185,17664,0,0,25344,0,8192,8192,0,0,0,0,18434,0,17922,0,0,8192,26116,17664,0,
+0,0,17410,0,0,0,17665,0,17152,25344,25344,0,8192,0,8192,0,25344,0,0,9478,0,8192,8192,0,
+0,0,0,25089,9474,0,8192,0,0,0,17152,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,25100,0,0,0,0,0,25096,0,25096,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,25092,25092,0,0,0,0,18179,17410,0,17409,0,25344,0,17152,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,27200,0,20349,19460,0,0,0,0,27392,10242,0,19457,0,26432,0,25104,0,
+0,0,0,0,26432,0,0,0,0,27216,27200,0,19461,0,26368,0,25104,0,19472,0,26384,0,0,26368,
+25104,25104,0,0,26176,0,26432,26176,0,0,0,0,0,0,0,0,27140,0,0,0,0,0,10242,0,
+27137,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,20333,10496,0,19781,0,26176,0,10496,0,
+10304,0,26176,0,0,26176,10304,9576,0,0,26368,0,26368,26368,0,0,0,0,10272,0,18976,0,0,18464,
+10272,9572,0,0,0,9570,0,0,0,9569,0,9568,18976,9570,0,18464,0,17952,0,9568,0,0,19200,0,
+26176,9572,0,0,0,0,26176,9570,0,9569,0,25152,0,9568,0,0,0,0,0,26368,0,0,0,0,
+0,0,0,0,18948,0,0,0,0,0,25090,0,18945,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25090,0,26432,9572,0,0,0,0,25090,25090,0,18433,0,25344,0,0,0,0,0,0,
+0,25152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,27408,19472,0,19461,0,26432,0,25104,0,27392,0,26368,0,0,26368,
+25104,25104,0,0,26192,0,26176,26176,0,0,0,0,27152,0,26128,0,0,18448,25104,25104,0,0,0,9554,
+0,0,0,25104,0,25104,26128,9554,0,18448,0,26128,0,25104,0,0,19222,0,26176,18436,0,0,0,0,
+27392,9554,0,9553,0,25152,0,25104,0,0,0,0,0,26176,0,0,0,0,10248,0,18952,0,0,18440,
+10248,9548,0,0,0,9546,0,0,0,9545,0,9544,18952,9546,0,18440,0,17928,0,9544,0,0,0,8192,
+0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,8192,8192,0,
+26176,18688,0,26176,0,25152,0,18176,0,9539,0,25152,0,0,25152,9537,9536,0,0,18176,0,26176,17664,0,
+0,0,0,0,25090,0,26432,18436,0,0,0,0,25090,25090,0,9545,0,25344,0,0,0,0,0,0,
+0,25152,0,0,0,0,25090,25090,0,26432,0,25344,0,0,0,25090,0,25346,0,0,25344,0,0,0,
+0,25154,0,25152,25152,0,0,0,0,0,0,0,0,17924,0,0,0,0,0,25090,0,9537,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27140,0,0,0,0,0,10242,0,
+27137,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27200,0,26368,9556,0,0,0,0,
+19027,9554,0,18433,0,26368,0,25104,0,0,0,0,0,25344,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26368,0,
+26368,9548,0,0,0,0,19008,9546,0,9545,0,26176,0,9544,0,0,0,0,0,25344,0,0,0,0,
+26368,9542,0,26368,0,26368,0,9540,0,18496,0,17984,0,0,17472,17984,9536,0,0,25344,0,25344,25344,0,
+0,0,0,0,0,0,0,9540,0,0,0,0,0,9538,0,9537,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9540,0,0,0,0,0,25090,0,17921,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19997,10248,0,19461,0,19260,0,25104,0,
+19472,0,26128,0,0,18448,25104,25104,0,0,18952,0,19257,18440,0,0,0,0,10241,0,26130,0,0,18484,
+25104,8192,0,0,0,26128,0,0,0,25104,0,25104,27137,8192,0,18433,0,26368,0,8192,0,0,26128,0,
+18997,18436,0,0,0,0,26128,9522,0,9521,0,26128,0,25104,0,0,0,0,0,26144,0,0,0,0,
+10244,0,18948,0,0,18436,10244,9516,0,0,0,8192,0,0,0,8192,0,8192,19241,9514,0,18729,0,18216,
+0,9512,0,0,0,9510,0,0,0,9509,0,25092,0,0,0,0,0,0,0,0,8192,9507,0,25090,
+0,0,17440,25089,8192,0,18948,9510,0,18436,0,17924,0,9508,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,18176,0,18209,17664,0,0,0,0,0,25090,0,18989,9516,0,0,0,0,25090,25090,0,18433,0,25344,
+0,0,0,0,0,0,0,17928,0,0,0,0,25090,8192,0,18433,0,25344,0,0,0,25090,0,25346,
+0,0,25344,0,0,0,0,8192,0,17921,8192,0,0,0,0,0,0,0,0,25120,0,0,0,0,
+0,25122,0,25120,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,19472,0,26130,0,0,18452,
+25104,25104,0,0,0,9498,0,0,0,25104,0,25104,26114,18440,0,18457,0,18200,0,25104,0,0,0,26128,
+0,0,0,25104,0,25108,0,0,0,0,0,0,0,0,25104,9491,0,25090,0,0,17424,25105,8192,0,
+19222,18452,0,18436,0,18196,0,25104,0,9491,0,9490,0,0,9488,25104,25104,0,0,18194,0,18193,17680,0,
+0,0,0,0,0,9486,0,0,0,9485,0,25092,0,0,0,0,0,0,0,0,8192,18440,0,25090,
+0,0,17416,25089,9480,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,0,18436,0,17924,0,0,17412,17924,9476,0,0,0,8192,0,0,0,
+8192,0,8192,18179,17664,0,17665,0,17152,0,17152,0,25090,25090,0,18437,0,25344,0,0,0,25090,0,25346,
+0,0,25344,0,0,0,0,25090,0,18185,17416,0,0,0,0,25090,0,25346,0,0,25344,0,0,0,
+0,0,25346,0,0,0,0,0,0,25090,8192,0,17409,0,25344,0,0,0,0,25090,0,18181,17412,0,
+0,0,0,25090,25090,0,9473,0,25344,0,0,0,0,0,0,0,17152,0,0,0,0,0,10248,0,
+18973,9500,0,0,0,0,26128,9498,0,9497,0,26128,0,25104,0,0,0,0,0,25344,0,0,0,0,
+27137,8192,0,18433,0,26368,0,8192,0,9491,0,26128,0,0,17424,25104,8192,0,0,8192,0,25344,8192,0,
+0,0,0,0,0,0,0,25104,0,0,0,0,0,25104,0,25104,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,18948,9486,0,18436,0,17924,0,9484,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,25344,0,25344,25344,0,0,0,0,9479,0,26116,0,0,17412,9477,8192,0,0,0,8192,0,0,0,
+8192,0,8192,25344,8192,0,25344,0,25344,0,8192,0,0,9478,0,17924,9476,0,0,0,0,8192,8192,0,
+8192,0,8192,0,8192,0,0,0,0,0,25344,0,0,0,0,0,0,0,0,25096,0,0,0,0,
+0,25098,0,25096,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,17921,8192,0,
+0,0,0,25090,8192,0,17409,0,25344,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25344,0,0,0,0,0,25344,0,25344,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25344,0,25344,25344,0,0,0,0,25344,25344,0,25344,0,25344,0,25360,0,0,0,0,
+0,25360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25344,0,25344,25344,0,0,0,0,25344,25344,0,25344,0,25352,
+0,25344,0,0,0,0,0,25344,0,0,0,0,25344,25344,0,25344,0,25344,0,25344,0,25344,0,25344,
+0,0,25344,25344,25344,0,0,25344,0,25344,25344,0,0,0,0,0,0,0,0,25344,0,0,0,0,
+0,25344,0,25345,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25348,0,0,0,0,0,25346,0,25344,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25344,0,25344,25344,0,0,0,0,25344,25344,0,25344,0,25352,0,25360,0,0,0,0,
+0,25360,0,0,0,0,25344,25344,0,25344,0,25344,0,25360,0,25344,0,25344,0,0,25344,25360,25360,0,
+0,25360,0,25360,25360,0,0,0,0,0,0,0,0,25344,0,0,0,0,0,25344,0,25345,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,25344,25344,0,25344,0,25352,0,25344,0,25344,0,25352,
+0,0,25352,25344,25344,0,0,25344,0,25344,25344,0,0,0,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,0,8192,0,0,0,8192,0,8192,8192,8192,0,8192,0,8192,0,8192,0,0,25344,0,25345,25344,0,
+0,0,0,25345,25344,0,25345,0,0,0,25344,0,0,0,0,0,25344,0,0,0,0,0,0,0,
+0,25348,0,0,0,0,0,25346,0,25344,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25350,0,25348,25348,0,0,0,0,25346,25346,0,25344,0,25344,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25344,0,0,0,0,0,25344,0,25344,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25344,0,0,0,0,
+0,25344,0,25344,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25344,0,25344,25344,0,
+0,0,0,25344,25344,0,25344,0,25344,0,25344,0,0,0,0,0,25344,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,20496,0,27204,0,0,19664,27140,19472,0,0,0,10272,0,0,0,
+10272,0,10272,27203,10256,0,19600,0,26176,0,26128,0,0,0,19508,0,0,0,19472,0,25092,0,0,0,
+0,0,0,0,0,10272,19457,0,25090,0,0,18576,25089,9456,0,27200,19472,0,19472,0,25152,0,26128,0,
+10272,0,25152,0,0,25152,10272,9456,0,0,26128,0,26192,26128,0,0,0,0,0,0,19524,0,0,0,
+10241,0,25092,0,0,0,0,0,0,0,0,9448,19457,0,25090,0,0,18560,25089,8192,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+10241,0,25152,0,0,25152,26113,8192,0,0,0,25152,0,0,0,9441,0,25152,26113,8192,0,9441,0,25152,
+0,8192,0,20207,19626,0,19501,0,26184,0,25216,0,19488,0,18976,0,0,18464,25216,25216,0,0,25152,0,
+25152,25152,0,0,0,0,19651,0,26118,0,0,18660,25216,25216,0,0,0,18464,0,0,0,25216,0,25216,
+25152,25152,0,25152,0,25152,0,25280,0,0,25120,0,25120,25120,0,0,0,0,25120,25120,0,25120,0,25184,
+0,25248,0,0,0,0,0,25184,0,0,0,0,0,0,27140,0,0,0,27140,0,25092,0,0,0,
+0,0,0,0,0,8192,27139,0,25090,0,0,26176,25089,26128,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,19460,0,25152,0,0,25152,
+27140,9428,0,0,0,8192,0,0,0,8192,0,8192,26177,18448,0,26176,0,25152,0,26128,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,25152,0,0,0,9413,0,25156,0,0,0,0,0,0,0,0,8192,26113,0,25154,
+0,0,25152,25089,8192,0,19460,0,26116,0,0,18436,25216,25216,0,0,0,8192,0,0,0,8192,0,8192,
+25152,25152,0,25152,0,25152,0,25280,0,0,0,26116,0,0,0,25216,0,25220,0,0,0,0,0,0,
+0,0,8192,25152,0,25154,0,0,25152,25281,25280,0,18948,18436,0,18436,0,25152,0,25216,0,8192,0,8192,
+0,0,8192,8192,8192,0,0,25152,0,25152,25152,0,0,0,0,20177,19472,0,19472,0,26120,0,26128,0,
+19472,0,26120,0,0,26120,26128,26128,0,0,26128,0,26128,26128,0,0,0,0,19521,0,19158,0,0,18640,
+19153,9428,0,0,0,18640,0,0,0,18512,0,18128,19009,9426,0,10449,0,18128,0,9424,0,0,25104,0,
+25104,25104,0,0,0,0,25104,25104,0,25104,0,25168,0,25104,0,0,0,0,0,25104,0,0,0,0,
+10241,0,19142,0,0,18560,18945,8192,0,0,0,18496,0,0,0,9417,0,17984,18945,8192,0,9417,0,18048,
+0,8192,0,0,0,18630,0,0,0,18433,0,25092,0,0,0,0,0,0,0,0,17472,18433,0,25090,
+0,0,17536,25089,8192,0,10241,8192,0,9413,0,25152,0,8192,0,9411,0,25152,0,0,25152,9409,8192,0,
+0,8192,0,9409,8192,0,0,0,0,0,25096,0,25096,25096,0,0,0,0,25096,25096,0,25096,0,25096,
+0,25224,0,0,0,0,0,25160,0,0,0,0,19139,18496,0,18497,0,18116,0,25216,0,18627,0,18114,
+0,0,17600,25216,25216,0,0,25152,0,25152,25152,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10368,0,0,0,
+10368,0,25092,0,0,0,0,0,0,0,0,9400,10368,0,25090,0,0,18560,25089,9400,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+10368,0,10368,0,0,10368,10368,9396,0,0,0,9394,0,0,0,9393,0,9392,19072,9394,0,18560,0,18048,
+0,9392,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,
+0,0,0,25089,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,9382,0,0,0,9381,0,25092,0,0,0,0,0,0,
+0,0,8192,9379,0,25090,0,0,17536,25089,8192,0,19584,0,19072,0,0,18560,25216,25216,0,0,0,9386,
+0,0,0,25216,0,25216,19072,9386,0,18560,0,18048,0,25216,0,0,0,18560,0,0,0,25216,0,25220,
+0,0,0,0,0,0,0,0,25216,9379,0,25090,0,0,17536,25217,8192,0,25120,25120,0,25120,0,25120,
+0,25248,0,25120,0,25120,0,0,25120,25248,25248,0,0,25120,0,25120,25120,0,0,0,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9366,0,0,0,9365,0,25092,0,0,0,0,0,0,0,0,8192,18560,0,25090,
+0,0,17536,25089,9360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,9358,0,0,0,25216,0,25220,
+0,0,0,0,0,0,0,0,8192,18560,0,25090,0,0,17536,25217,25216,0,0,0,0,0,0,0,
+0,0,25220,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25217,0,0,9351,0,9350,
+0,0,9348,25216,25216,0,0,0,8192,0,0,0,8192,0,8192,18048,17536,0,17536,0,17024,0,25216,0,
+10368,0,19072,0,0,18560,10368,9372,0,0,0,9370,0,0,0,9369,0,9368,10368,9370,0,10368,0,18048,
+0,9368,0,0,0,18560,0,0,0,9365,0,25092,0,0,0,0,0,0,0,0,9360,9363,0,25090,
+0,0,17536,25089,8192,0,25104,25104,0,25104,0,25104,0,25104,0,25104,0,25104,0,0,25104,25104,25104,0,
+0,25104,0,25104,25104,0,0,0,0,0,0,9358,0,0,0,9357,0,25092,0,0,0,0,0,0,
+0,0,8192,9355,0,25090,0,0,17536,25089,8192,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,9351,0,9350,0,0,9348,9349,8192,0,
+0,0,8192,0,0,0,8192,0,8192,9347,8192,0,9345,0,17024,0,8192,0,25096,25096,0,25096,0,25096,
+0,25224,0,25096,0,25096,0,0,25096,25224,25224,0,0,25096,0,25096,25096,0,0,0,0,9351,0,18048,
+0,0,17536,25216,8192,0,0,0,17536,0,0,0,25216,0,25216,9347,8192,0,9345,0,17024,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,27149,10256,0,19457,0,25096,0,26128,0,10272,0,25096,0,0,25096,18976,9400,0,0,25104,0,
+25104,25104,0,0,0,0,19504,0,26116,0,0,18480,26132,26128,0,0,0,18464,0,0,0,18464,0,17952,
+25104,25104,0,25104,0,25104,0,25104,0,0,26128,0,25089,9396,0,0,0,0,25089,9394,0,25089,0,0,
+0,9392,0,0,0,0,0,25104,0,0,0,0,19457,0,25096,0,0,25096,26113,8192,0,0,0,25096,
+0,0,0,9385,0,25096,26113,8192,0,9385,0,25096,0,8192,0,0,0,18464,0,0,0,9381,0,25092,
+0,0,0,0,0,0,0,0,17440,9379,0,25090,0,0,9376,25089,8192,0,25089,8192,0,25089,0,0,
+0,8192,0,25089,0,0,0,0,0,25089,8192,0,0,8192,0,25089,8192,0,0,0,0,0,25092,0,
+25092,25092,0,0,0,0,18976,9386,0,9385,0,25096,0,25216,0,0,0,0,0,0,0,0,0,0,
+25092,25092,0,25092,0,25092,0,25220,0,18464,0,17952,0,0,17440,25216,25216,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25124,0,0,0,0,0,25120,0,25121,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,10244,0,25096,0,0,25096,26116,9372,0,0,0,8192,0,0,0,8192,0,8192,
+25104,25104,0,25104,0,25112,0,25104,0,0,0,9366,0,0,0,9365,0,25092,0,0,0,0,0,0,
+0,0,8192,25104,0,25106,0,0,25104,25105,25104,0,25089,9366,0,25089,0,0,0,9364,0,8192,0,0,
+0,0,0,8192,8192,0,0,25104,0,25105,25104,0,0,0,0,0,0,25096,0,0,0,9357,0,25100,
+0,0,0,0,0,0,0,0,8192,9355,0,25098,0,0,25096,25089,8192,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,25089,0,0,
+0,0,0,25089,8192,0,0,0,0,0,0,0,8192,0,0,25089,8192,0,25089,0,0,0,8192,0,
+25092,25092,0,25092,0,25100,0,25220,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,0,0,0,0,
+0,0,0,25092,0,25092,0,0,25092,25220,25220,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,
+0,0,0,0,0,0,0,25092,0,25093,25092,0,0,0,0,8192,8192,0,8192,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,26128,0,26136,9372,0,0,0,0,26120,9370,0,18433,0,25096,
+0,26128,0,0,0,0,0,25104,0,0,0,0,19095,18448,0,18449,0,18068,0,26128,0,18451,0,18066,
+0,0,17552,18065,17424,0,0,25104,0,25104,25104,0,0,0,0,0,0,0,0,25104,0,0,0,0,
+0,25104,0,25105,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,18945,8192,0,9357,0,25096,
+0,8192,0,18433,0,25096,0,0,25096,17921,8192,0,0,8192,0,9353,8192,0,0,0,0,18433,0,18054,
+0,0,17536,17921,8192,0,0,0,17538,0,0,0,17409,0,17024,17921,8192,0,9345,0,17024,0,8192,0,
+0,8192,0,25089,8192,0,0,0,0,25089,8192,0,25089,0,0,0,8192,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,25100,0,0,0,0,0,25096,0,25096,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,18051,17410,0,17409,0,17024,0,25216,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,27200,0,0,0,19520,0,25092,0,0,0,
+0,0,0,0,0,9336,10304,0,25090,0,0,9336,25089,9336,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,27200,0,25152,0,0,25152,
+27200,9332,0,0,0,25152,0,0,0,9329,0,25152,26176,9330,0,9329,0,25152,0,9328,0,0,0,0,
+0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,25152,0,0,0,9317,0,25156,0,0,0,0,0,0,0,0,25152,9315,0,25154,
+0,0,8192,25089,8192,0,19520,0,26176,0,0,26176,19008,18496,0,0,0,9322,0,0,0,9321,0,9320,
+25152,25152,0,25152,0,25152,0,25152,0,0,0,18496,0,0,0,18496,0,25092,0,0,0,0,0,0,
+0,0,9312,25152,0,25154,0,0,25152,25153,25152,0,25120,25120,0,25120,0,25184,0,25120,0,25120,0,25184,
+0,0,25184,25120,25120,0,0,25184,0,25184,25184,0,0,0,0,0,0,0,0,0,0,0,0,25092,
+0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25152,
+0,0,0,9301,0,25156,0,0,0,0,0,0,0,0,8192,26176,0,25154,0,0,25152,25089,9296,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,25156,0,0,0,0,0,0,0,0,0,
+0,0,25154,0,0,0,25089,0,0,0,0,9294,0,0,0,9293,0,25092,0,0,0,0,0,0,
+0,0,8192,25152,0,25154,0,0,25152,25153,25152,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25154,0,0,0,25153,0,0,9287,0,25152,0,0,25152,9285,9284,0,
+0,0,8192,0,0,0,8192,0,8192,25152,25152,0,25152,0,25152,0,25152,0,10304,0,27200,0,0,9308,
+27200,9308,0,0,0,18496,0,0,0,18496,0,17984,10304,9306,0,9305,0,9304,0,9304,0,0,0,18496,
+0,0,0,18496,0,25092,0,0,0,0,0,0,0,0,17472,10304,0,25090,0,0,9296,25089,9296,0,
+25104,25104,0,25104,0,25168,0,25104,0,25104,0,25168,0,0,25168,25104,25104,0,0,25104,0,25104,25104,0,
+0,0,0,0,0,9294,0,0,0,9293,0,25092,0,0,0,0,0,0,0,0,17472,9291,0,25090,
+0,0,8192,25089,8192,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,0,0,0,0,
+0,0,25090,0,0,0,25089,0,0,9287,0,25152,0,0,8192,9285,8192,0,0,0,25152,0,0,0,
+9281,0,25152,9283,8192,0,8192,0,8192,0,8192,0,25096,25096,0,25096,0,25096,0,25096,0,25096,0,25096,
+0,0,25096,25096,25096,0,0,25160,0,25160,25160,0,0,0,0,18496,0,17984,0,0,17472,17984,17472,0,
+0,0,17472,0,0,0,17472,0,16960,25152,25152,0,25152,0,25152,0,25152,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,
+0,0,8192,8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,0,0,8192,0,0,0,8192,0,8192,
+0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,8192,8192,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,8192,0,8192,
+0,0,8192,8192,8192,0,0,0,8192,0,0,0,8192,0,8192,8192,8192,0,8192,0,8192,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,
+8192,8192,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,
+0,0,8192,8192,8192,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,8192,0,0,0,
+8192,0,8192,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,8192,8192,0,8192,0,8192,
+0,0,8192,8192,8192,0,0,0,8192,0,0,0,8192,0,8192,8192,8192,0,8192,0,8192,0,8192,0,
+0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,
+8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,27145,0,25096,0,0,25096,26117,18448,0,0,0,25096,0,0,0,18464,0,25096,
+25104,25104,0,25104,0,25112,0,25104,0,0,0,26116,0,0,0,26116,0,25092,0,0,0,0,0,0,
+0,0,17440,25104,0,25106,0,0,25104,25105,25104,0,25089,26128,0,25089,0,0,0,26128,0,25089,0,0,
+0,0,0,25089,9264,0,0,25104,0,25105,25104,0,0,0,0,0,0,25096,0,0,0,26113,0,25100,
+0,0,0,0,0,0,0,0,25096,9259,0,25098,0,0,8192,25089,8192,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,25089,0,0,
+0,0,0,25089,8192,0,0,0,0,0,0,0,25089,0,0,25089,8192,0,8192,0,0,0,8192,0,
+25092,25092,0,25092,0,25100,0,25092,0,18464,0,25096,0,0,25096,17952,17440,0,0,0,0,0,0,0,
+0,0,0,25092,0,25092,0,0,25092,25092,25092,0,0,0,17440,0,0,0,17440,0,16928,0,0,0,
+0,0,0,0,0,0,0,25124,0,25125,25124,0,0,0,0,25121,25120,0,25121,0,0,0,25120,0,
+0,0,0,0,0,0,0,0,0,0,0,25096,0,0,0,26116,0,25100,0,0,0,0,0,0,
+0,0,8192,25104,0,25114,0,0,25112,25105,25104,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25106,0,0,0,25105,0,0,25089,0,0,0,0,0,25089,9236,0,
+0,0,0,0,0,0,8192,0,0,25105,25104,0,25105,0,0,0,25104,0,0,0,0,0,0,0,
+0,0,25100,0,0,0,0,0,0,0,0,0,0,0,25098,0,0,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,25089,0,0,0,0,0,0,0,0,0,0,0,25089,0,0,0,0,0,
+25089,8192,0,25092,0,25100,0,0,25100,25092,25092,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,8192,
+0,0,0,0,0,0,0,0,0,25093,25092,0,25093,0,0,0,25092,0,8192,0,0,0,0,0,
+8192,8192,0,0,0,0,0,0,0,0,0,0,26136,26128,0,26128,0,25096,0,26128,0,26120,0,25096,
+0,0,25096,26120,17424,0,0,25104,0,25104,25104,0,0,0,0,18451,0,26116,0,0,17424,26116,17424,0,
+0,0,17426,0,0,0,17425,0,16912,25104,25104,0,25104,0,25104,0,25104,0,0,25104,0,25105,25104,0,
+0,0,0,25105,25104,0,25105,0,0,0,25104,0,0,0,0,0,25104,0,0,0,0,9231,0,25096,
+0,0,8192,26113,8192,0,0,0,25096,0,0,0,17409,0,25096,9227,8192,0,8192,0,8192,0,8192,0,
+0,0,17410,0,0,0,17409,0,25092,0,0,0,0,0,0,0,0,16384,9219,0,25090,0,0,8192,
+25089,8192,0,25089,8192,0,8192,0,0,0,8192,0,25089,0,0,0,0,0,25089,8192,0,0,8192,0,
+8192,8192,0,0,0,0,0,25100,0,25100,25100,0,0,0,0,25096,25096,0,25096,0,25096,0,25096,0,
+0,0,0,0,0,0,0,0,0,25092,25092,0,25092,0,25092,0,25092,0,17411,0,16898,0,0,16384,
+16897,16384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20021,19472,0,19461,0,19068,0,25104,0,
+10272,0,18976,0,0,18464,25104,25104,0,0,26128,0,19065,18448,0,0,0,0,19472,0,26114,0,0,18484,
+25104,25104,0,0,0,18464,0,0,0,25104,0,25104,26130,9330,0,18449,0,18032,0,25104,0,0,26128,0,
+18997,9332,0,0,0,0,10272,9330,0,9329,0,25152,0,25104,0,0,0,0,0,26128,0,0,0,0,
+10241,0,19052,0,0,18540,10241,8192,0,0,0,9322,0,0,0,9321,0,9320,18945,8192,0,18433,0,18024,
+0,8192,0,0,0,18464,0,0,0,9317,0,25092,0,0,0,0,0,0,0,0,9312,9315,0,25090,
+0,0,17440,25089,8192,0,18945,8192,0,18433,0,25152,0,8192,0,9315,0,25152,0,0,25152,9313,8192,0,
+0,8192,0,17921,8192,0,0,0,0,0,25090,0,18989,18436,0,0,0,0,25090,25090,0,9321,0,17952,
+0,0,0,0,0,0,0,25152,0,0,0,0,25090,25090,0,18437,0,18020,0,0,0,25090,0,25090,
+0,0,17440,0,0,0,0,25154,0,25152,25152,0,0,0,0,0,0,0,0,25120,0,0,0,0,
+0,25122,0,25120,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,10244,0,27140,0,0,18436,
+25104,25104,0,0,0,8192,0,0,0,8192,0,8192,26130,26128,0,18457,0,26176,0,25104,0,0,0,9302,
+0,0,0,25104,0,25108,0,0,0,0,0,0,0,0,8192,26128,0,25090,0,0,17424,25105,25104,0,
+27140,9302,0,18436,0,25152,0,25104,0,8192,0,8192,0,0,8192,8192,8192,0,0,26128,0,26176,17424,0,
+0,0,0,0,0,9294,0,0,0,9293,0,25092,0,0,0,0,0,0,0,0,8192,9291,0,25090,
+0,0,17416,25089,8192,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,8192,0,0,9287,0,25152,0,0,25152,9285,8192,0,0,0,8192,0,0,0,
+8192,0,8192,26113,8192,0,17409,0,25152,0,8192,0,25090,25090,0,18436,0,17924,0,0,0,8192,0,8192,
+0,0,8192,0,0,0,0,25154,0,25152,25152,0,0,0,0,25090,0,25090,0,0,17412,0,0,0,
+0,0,8192,0,0,0,0,0,0,25154,25154,0,25152,0,25152,0,0,0,0,25090,0,17924,17412,0,
+0,0,0,8192,8192,0,8192,0,8192,0,0,0,0,0,0,0,25152,0,0,0,0,0,26128,0,
+18973,9308,0,0,0,0,26128,9306,0,18433,0,26120,0,25104,0,0,0,0,0,26128,0,0,0,0,
+19027,9302,0,18433,0,18004,0,25104,0,18449,0,18002,0,0,17488,25104,25104,0,0,9298,0,18001,9296,0,
+0,0,0,0,0,0,0,25104,0,0,0,0,0,25104,0,25104,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,18945,8192,0,18433,0,17996,0,8192,0,9291,0,17984,0,0,17472,9289,8192,0,
+0,8192,0,17921,8192,0,0,0,0,18433,0,17990,0,0,17476,17921,8192,0,0,0,17472,0,0,0,
+9281,0,16960,17921,8192,0,17409,0,16960,0,8192,0,0,8192,0,17921,8192,0,0,0,0,9283,8192,0,
+9281,0,25152,0,8192,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,25096,0,0,0,0,
+0,25098,0,25096,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25090,0,17989,9284,0,
+0,0,0,25090,25090,0,17409,0,16960,0,0,0,0,0,0,0,25152,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+19472,0,26114,0,0,18484,25104,25104,0,0,0,9274,0,0,0,25104,0,25104,26114,9274,0,18457,0,17976,
+0,25104,0,0,0,26114,0,0,0,25104,0,25108,0,0,0,0,0,0,0,0,25104,18433,0,25090,
+0,0,17456,25105,8192,0,26128,26128,0,18452,0,17972,0,25104,0,9267,0,9266,0,0,9264,25104,25104,0,
+0,26128,0,17969,17424,0,0,0,0,0,0,18436,0,0,0,9261,0,25092,0,0,0,0,0,0,
+0,0,8192,18433,0,25090,0,0,17448,25089,8192,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,9255,0,17924,0,0,17412,9253,8192,0,
+0,0,8192,0,0,0,8192,0,8192,17921,8192,0,17409,0,16928,0,8192,0,25090,25090,0,18477,0,17964,
+0,0,0,25090,0,25090,0,0,17440,0,0,0,0,25090,0,17961,17416,0,0,0,0,25090,0,25090,
+0,0,17444,0,0,0,0,0,25090,0,0,0,0,0,0,25090,8192,0,17409,0,16928,0,0,0,
+0,25122,0,25120,25120,0,0,0,0,25122,25122,0,25120,0,25120,0,0,0,0,0,0,0,25120,0,
+0,0,0,0,0,18436,0,0,0,25104,0,25108,0,0,0,0,0,0,0,0,8192,26114,0,25090,
+0,0,17432,25105,25104,0,0,0,0,0,0,0,0,0,25108,0,0,0,0,0,0,0,0,0,
+0,0,25090,0,0,0,25105,0,0,18436,0,17924,0,0,17412,25104,25104,0,0,0,8192,0,0,0,
+8192,0,8192,26114,17424,0,17425,0,16912,0,25104,0,0,0,0,0,0,0,0,0,25092,0,0,0,
+0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17412,0,0,0,
+9221,0,25092,0,0,0,0,0,0,0,0,8192,17409,0,25090,0,0,16384,25089,8192,0,25090,0,25090,
+0,0,17412,0,0,0,0,0,8192,0,0,0,0,0,0,25090,25090,0,17417,0,16904,0,0,0,
+0,0,25090,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25090,0,25090,0,0,16384,
+0,0,0,25090,25090,0,17412,0,16900,0,0,0,8192,0,8192,0,0,8192,0,0,0,0,25090,0,
+16897,16384,0,0,0,0,26128,9246,0,18449,0,17948,0,25104,0,26128,0,26128,0,0,17424,25104,25104,0,
+0,9242,0,17945,9240,0,0,0,0,18433,0,26114,0,0,17428,25104,8192,0,0,0,17424,0,0,0,
+25104,0,25104,17921,8192,0,17409,0,16912,0,8192,0,0,25104,0,25104,25104,0,0,0,0,25104,25104,0,
+25104,0,25104,0,25104,0,0,0,0,0,25104,0,0,0,0,9231,0,17924,0,0,17412,9229,8192,0,
+0,0,8192,0,0,0,8192,0,8192,17921,8192,0,17409,0,16904,0,8192,0,0,0,17412,0,0,0,
+9221,0,25092,0,0,0,0,0,0,0,0,8192,17409,0,25090,0,0,16384,25089,8192,0,9223,8192,0,
+9221,0,16900,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,8192,0,16897,8192,0,0,0,0,
+0,25098,0,25096,25096,0,0,0,0,25098,25098,0,25096,0,25096,0,0,0,0,0,0,0,25096,0,
+0,0,0,25090,8192,0,17409,0,16900,0,0,0,25090,0,25090,0,0,16384,0,0,0,0,8192,0,
+16897,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,26128,0,18949,9276,0,0,0,0,10272,9274,0,9273,0,25096,
+0,25104,0,0,0,0,0,25104,0,0,0,0,26128,26128,0,10293,0,17972,0,25104,0,10272,0,17952,
+0,0,17440,25104,25104,0,0,25104,0,25104,25104,0,0,0,0,0,0,0,0,9268,0,0,0,0,
+0,9266,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,18945,8192,0,18433,0,25096,
+0,8192,0,9259,0,25096,0,0,25096,9257,8192,0,0,8192,0,17921,8192,0,0,0,0,9255,0,17952,
+0,0,17440,9253,8192,0,0,0,17440,0,0,0,9249,0,16928,9251,8192,0,9249,0,16928,0,8192,0,
+0,8192,0,25089,8192,0,0,0,0,25089,8192,0,25089,0,0,0,8192,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,9257,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25094,0,25092,25092,0,0,0,0,25090,25090,0,9249,0,16928,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,10244,9246,0,10244,0,25096,0,25104,0,8192,0,8192,
+0,0,8192,8192,8192,0,0,25104,0,25104,25104,0,0,0,0,9239,0,9238,0,0,9236,25104,25104,0,
+0,0,8192,0,0,0,8192,0,8192,25104,25104,0,25104,0,25104,0,25104,0,0,9238,0,25089,9236,0,
+0,0,0,8192,8192,0,8192,0,0,0,8192,0,0,0,0,0,25104,0,0,0,0,9231,0,25096,
+0,0,25096,9229,8192,0,0,0,8192,0,0,0,8192,0,8192,9227,8192,0,9225,0,25096,0,8192,0,
+0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,
+8192,8192,0,25089,8192,0,25089,0,0,0,8192,0,8192,0,0,0,0,0,8192,8192,0,0,8192,0,
+25089,8192,0,0,0,0,0,25094,0,25092,25092,0,0,0,0,8192,8192,0,8192,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,0,25094,25094,0,25092,0,25092,0,0,0,8192,0,8192,0,0,8192,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,8192,0,
+8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9244,0,0,0,0,
+0,9242,0,17921,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26128,0,17941,9236,0,
+0,0,0,17939,9234,0,17409,0,16912,0,25104,0,0,0,0,0,25104,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,8192,0,17921,8192,0,0,0,0,17921,8192,0,17409,0,25096,0,8192,0,0,0,0,0,8192,0,
+0,0,0,17921,8192,0,17409,0,16900,0,8192,0,17409,0,16898,0,0,16384,16897,8192,0,0,8192,0,
+16897,8192,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,25089,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,25090,0,
+16897,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27204,0,27220,27140,0,
+0,0,0,27329,10242,0,10241,0,25104,0,26240,0,0,0,0,0,25120,0,0,0,0,27220,27200,0,
+27204,0,25104,0,27200,0,19520,0,25104,0,0,25104,26256,18496,0,0,25120,0,25120,25120,0,0,0,0,
+0,0,0,0,27140,0,0,0,0,0,18946,0,26113,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20207,19524,0,19584,0,19072,0,19052,0,19520,0,26176,0,0,9448,19008,18496,0,0,25120,0,
+25120,25120,0,0,0,0,19488,0,18976,0,0,9444,18976,9444,0,0,0,9442,0,0,0,9441,0,9440,
+25120,25120,0,25120,0,25120,0,25120,0,0,19142,0,19072,9444,0,0,0,0,26176,9442,0,9441,0,25152,
+0,17984,0,0,0,0,0,25120,0,0,0,0,0,0,0,0,26116,0,0,0,0,0,18946,0,
+25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26176,0,25089,9444,0,0,0,0,
+25089,9442,0,25089,0,0,0,25216,0,0,0,0,0,25184,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,27344,19544,0,
+27200,0,25104,0,26240,0,27328,0,25104,0,0,25104,26256,26240,0,0,26176,0,26192,26176,0,0,0,0,
+27152,0,25104,0,0,25104,26128,9428,0,0,0,25104,0,0,0,26128,0,25104,26128,9426,0,26128,0,25104,
+0,9424,0,0,19158,0,26177,18436,0,0,0,0,26177,18434,0,26113,0,25168,0,26240,0,0,0,0,
+0,26176,0,0,0,0,19464,0,18952,0,0,9420,18952,18440,0,0,0,9418,0,0,0,9417,0,9416,
+18952,18440,0,9417,0,9416,0,17928,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,
+0,0,8192,8192,0,8192,0,0,8192,8192,8192,0,26176,18630,0,18560,0,25152,0,18116,0,26176,0,25152,
+0,0,25152,26176,17472,0,0,18114,0,18048,17536,0,0,0,0,0,26304,0,25089,18436,0,0,0,0,
+25089,18434,0,25089,0,0,0,25216,0,0,0,0,0,25152,0,0,0,0,25089,26176,0,25089,0,0,
+0,25216,0,25089,0,0,0,0,0,25217,25216,0,0,25152,0,25153,25152,0,0,0,0,0,0,0,
+0,17924,0,0,0,0,0,17922,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25092,0,0,0,0,0,10242,0,10241,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25092,0,25092,25092,0,0,0,0,19009,9426,0,10241,0,25104,0,17984,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,19008,9418,0,9417,0,9416,
+0,17984,0,0,0,0,0,0,0,0,0,0,25092,25092,0,25092,0,25092,0,25092,0,18496,0,17984,
+0,0,9408,17984,17472,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,9410,0,9409,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,9410,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,27173,10248,0,19460,0,25104,0,18952,0,10256,0,25104,0,0,25104,26128,9400,0,0,25120,0,
+25120,25120,0,0,0,0,10241,0,25104,0,0,25104,26113,8192,0,0,0,25104,0,0,0,9393,0,25104,
+25120,8192,0,25120,0,25136,0,8192,0,0,26144,0,26160,18436,0,0,0,0,26128,9394,0,9393,0,25104,
+0,26128,0,0,0,0,0,25120,0,0,0,0,19460,0,26116,0,0,9388,26116,9388,0,0,0,8192,
+0,0,0,8192,0,8192,25120,25120,0,25120,0,25120,0,25120,0,0,0,9382,0,0,0,9381,0,25092,
+0,0,0,0,0,0,0,0,8192,25120,0,25122,0,0,25120,25121,8192,0,18948,18436,0,9381,0,9380,
+0,17924,0,8192,0,8192,0,0,8192,8192,8192,0,0,25120,0,25120,25120,0,0,0,0,0,18952,0,
+25089,9388,0,0,0,0,25089,9386,0,25089,0,0,0,25216,0,0,0,0,0,25120,0,0,0,0,
+25089,8192,0,25089,0,0,0,8192,0,25089,0,0,0,0,0,25217,8192,0,0,8192,0,25121,8192,0,
+0,0,0,0,0,0,0,25120,0,0,0,0,0,25120,0,25121,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,19480,0,25104,0,0,25104,26129,18440,0,0,0,25104,0,0,0,26128,0,25104,
+26113,18440,0,18456,0,25104,0,17928,0,0,0,25104,0,0,0,9365,0,25108,0,0,0,0,0,0,
+0,0,25104,9363,0,25106,0,0,25104,25089,8192,0,19095,18454,0,18452,0,25104,0,18068,0,18448,0,25104,
+0,0,25104,26128,17424,0,0,18066,0,18065,17552,0,0,0,0,0,0,9358,0,0,0,9357,0,25092,
+0,0,0,0,0,0,0,0,8192,18440,0,25090,0,0,9352,25089,17416,0,0,0,0,0,0,0,
+0,0,8192,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,18436,0,17924,
+0,0,9348,17924,17412,0,0,0,8192,0,0,0,8192,0,8192,18051,17538,0,17536,0,17024,0,17024,0,
+25089,18440,0,25089,0,0,0,25216,0,25089,0,0,0,0,0,25217,25216,0,0,17928,0,25089,17416,0,
+0,0,0,25089,0,0,0,0,0,25217,8192,0,0,0,0,0,0,0,25217,0,0,25089,8192,0,
+25089,0,0,0,8192,0,0,18054,0,25089,17412,0,0,0,0,25089,17410,0,25089,0,0,0,25216,0,
+0,0,0,0,17024,0,0,0,0,0,25092,0,25092,25092,0,0,0,0,26128,9370,0,9369,0,25104,
+0,9368,0,0,0,0,0,0,0,0,0,0,25092,8192,0,25092,0,25108,0,8192,0,9363,0,25104,
+0,0,25104,9361,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25108,0,0,0,0,
+0,25104,0,25104,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,25092,0,25092,0,25092,
+0,25092,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,0,0,0,0,0,0,0,25092,0,25092,
+0,0,25092,25092,8192,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,
+0,25092,0,25092,25092,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25100,0,0,0,0,0,25096,0,25097,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,25093,8192,0,0,0,0,25089,8192,0,25089,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25216,0,0,0,0,0,25216,0,
+25216,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25216,0,25216,25216,0,0,0,0,
+25216,25216,0,25216,0,25232,0,25216,0,0,0,0,0,25264,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25216,0,
+25216,25216,0,0,0,0,25216,25216,0,25216,0,25224,0,25216,0,0,0,0,0,25248,0,0,0,0,
+25216,25216,0,25216,0,25216,0,25216,0,25216,0,25216,0,0,25216,25216,25216,0,0,25248,0,25248,25248,0,
+0,0,0,0,0,0,0,25216,0,0,0,0,0,25216,0,25217,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,25216,0,25217,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25216,0,25216,25216,0,0,0,0,
+25216,25216,0,25216,0,25240,0,25216,0,0,0,0,0,25232,0,0,0,0,25216,25216,0,25216,0,25232,
+0,25216,0,25216,0,25232,0,0,25232,25216,25216,0,0,25232,0,25232,25232,0,0,0,0,0,0,0,
+0,25216,0,0,0,0,0,25216,0,25217,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+25216,25216,0,25216,0,25224,0,25216,0,25216,0,25224,0,0,25224,25216,25216,0,0,25216,0,25216,25216,0,
+0,0,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,8192,0,0,0,8192,0,8192,8192,8192,0,
+8192,0,8192,0,8192,0,0,25216,0,25217,25216,0,0,0,0,25217,25216,0,25217,0,0,0,25216,0,
+0,0,0,0,25216,0,0,0,0,0,0,0,0,25220,0,0,0,0,0,25216,0,25217,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25220,0,25221,25220,0,0,0,0,25217,25216,0,
+25217,0,0,0,25216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25220,0,0,0,0,0,25216,0,25216,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25220,0,0,0,0,0,25216,0,25216,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25220,0,25220,25220,0,0,0,0,25216,25216,0,25216,0,25216,0,25216,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27188,19478,0,
+27152,0,25104,0,19068,0,19474,0,25104,0,0,25104,19065,18520,0,0,25120,0,25120,25120,0,0,0,0,
+27140,0,25104,0,0,25104,26117,18496,0,0,0,25104,0,0,0,18512,0,25104,25120,25120,0,25120,0,25136,
+0,25120,0,0,26144,0,26128,9332,0,0,0,0,26129,18434,0,9329,0,25168,0,18032,0,0,0,0,
+0,25120,0,0,0,0,19458,0,18946,0,0,8192,26116,18540,0,0,0,9322,0,0,0,18496,0,17984,
+25120,25120,0,8192,0,8192,0,25120,0,0,0,9318,0,0,0,18464,0,25092,0,0,0,0,0,0,
+0,0,9312,25120,0,25122,0,0,8192,25121,25120,0,18946,18434,0,8192,0,8192,0,18020,0,9315,0,25152,
+0,0,8192,17984,17472,0,0,25120,0,8192,8192,0,0,0,0,0,26148,0,25089,26116,0,0,0,0,
+25089,18434,0,25089,0,0,0,18024,0,0,0,0,0,25184,0,0,0,0,25089,18496,0,25089,0,0,
+0,17984,0,25089,0,0,0,0,0,25089,17472,0,0,25184,0,25185,25184,0,0,0,0,0,0,0,
+0,25120,0,0,0,0,0,25120,0,25121,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+19482,0,25104,0,0,25104,26113,18520,0,0,0,25104,0,0,0,18520,0,25104,26129,18456,0,26128,0,25104,
+0,18008,0,0,0,25104,0,0,0,18448,0,25108,0,0,0,0,0,0,0,0,25104,26128,0,25106,
+0,0,25104,25089,9296,0,26113,18454,0,18448,0,25168,0,18004,0,26113,0,25168,0,0,25168,26113,17488,0,
+0,18002,0,26128,17424,0,0,0,0,0,0,9294,0,0,0,18440,0,25092,0,0,0,0,0,0,
+0,0,9288,9291,0,25090,0,0,8192,25089,17416,0,0,0,0,0,0,0,0,0,8192,0,0,0,
+0,0,0,0,0,0,0,0,8192,0,0,0,8192,0,0,18434,0,25152,0,0,8192,26113,17476,0,
+0,0,25152,0,0,0,17472,0,25152,17922,17410,0,8192,0,8192,0,16960,0,25089,18510,0,25089,0,0,
+0,17996,0,25089,0,0,0,0,0,25089,17480,0,0,25152,0,25153,25152,0,0,0,0,25089,0,0,
+0,0,0,25089,17472,0,0,0,0,0,0,0,25089,0,0,25153,25152,0,25153,0,0,0,25152,0,
+0,17990,0,25089,17412,0,0,0,0,25089,17410,0,25089,0,0,0,16960,0,0,0,0,0,25152,0,
+0,0,0,0,25092,0,25092,25092,0,0,0,0,26128,10242,0,9305,0,25104,0,18008,0,0,0,0,
+0,0,0,0,0,0,25092,25092,0,25092,0,25108,0,25092,0,10323,0,25104,0,0,25104,18001,17472,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25108,0,0,0,0,0,25104,0,25104,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,25092,25092,0,8192,0,8192,0,25092,0,9291,0,9290,
+0,0,8192,17984,17472,0,0,0,0,0,0,0,0,0,0,25092,0,25092,0,0,8192,25092,25092,0,
+0,0,9282,0,0,0,17472,0,16960,0,0,0,0,0,0,0,0,0,0,25092,0,8192,8192,0,
+0,0,0,9283,9282,0,8192,0,8192,0,16960,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25100,0,0,0,0,0,25096,0,25097,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,25093,25092,0,0,0,0,25089,9282,0,25089,0,0,0,16960,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,27172,0,25104,0,0,25104,26117,18440,0,0,0,25104,0,0,0,18448,0,25104,
+25120,25120,0,25120,0,25136,0,25120,0,0,0,25104,0,0,0,26113,0,25108,0,0,0,0,0,0,
+0,0,25104,25120,0,25138,0,0,25136,25121,8192,0,26160,26144,0,26128,0,25104,0,26144,0,26128,0,25104,
+0,0,25104,26128,17424,0,0,25120,0,25120,25120,0,0,0,0,0,0,9262,0,0,0,26116,0,25092,
+0,0,0,0,0,0,0,0,8192,25120,0,25122,0,0,8192,25121,25120,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25122,0,0,0,25121,0,0,9255,0,9254,
+0,0,8192,26116,17412,0,0,0,8192,0,0,0,8192,0,8192,25120,25120,0,8192,0,8192,0,25120,0,
+25089,18440,0,25089,0,0,0,17928,0,25089,0,0,0,0,0,25089,17416,0,0,25120,0,25121,25120,0,
+0,0,0,25089,0,0,0,0,0,25089,8192,0,0,0,0,0,0,0,25089,0,0,25121,8192,0,
+25121,0,0,0,8192,0,0,25120,0,25121,25120,0,0,0,0,25121,25120,0,25121,0,0,0,25120,0,
+0,0,0,0,25120,0,0,0,0,0,0,25104,0,0,0,26113,0,25108,0,0,0,0,0,0,
+0,0,25104,26113,0,25106,0,0,25104,25089,17416,0,0,0,0,0,0,0,0,0,25108,0,0,0,
+0,0,0,0,0,0,0,0,25106,0,0,0,25089,0,0,18454,0,25104,0,0,25104,26113,17428,0,
+0,0,25104,0,0,0,17424,0,25104,26113,17426,0,17424,0,25104,0,16912,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,0,0,0,0,0,0,0,0,25090,0,0,0,25089,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,9222,0,0,0,17412,0,25092,0,0,0,0,0,0,0,0,8192,17410,0,25090,0,0,8192,
+25089,16384,0,25089,0,0,0,0,0,25089,17416,0,0,0,0,0,0,0,25089,0,0,25089,17416,0,
+25089,0,0,0,16904,0,0,0,0,0,0,0,25089,0,0,0,0,0,0,0,0,0,0,0,
+25089,0,0,0,0,0,25089,8192,0,25089,17414,0,25089,0,0,0,16900,0,25089,0,0,0,0,0,
+25089,16384,0,0,16898,0,25089,16384,0,0,0,0,25092,25092,0,25092,0,25108,0,25092,0,26128,0,25104,
+0,0,25104,26128,9240,0,0,0,0,0,0,0,0,0,0,25092,0,25108,0,0,25108,25092,8192,0,
+0,0,25104,0,0,0,9233,0,25104,0,0,0,0,0,0,0,0,0,0,25108,0,25108,25108,0,
+0,0,0,25104,25104,0,25104,0,25104,0,25104,0,0,0,0,0,0,0,0,0,0,25092,0,25092,
+0,0,8192,25092,25092,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,0,
+0,0,25092,0,0,0,25092,0,25092,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,
+0,0,0,25092,25092,0,8192,0,8192,0,25092,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,0,
+0,0,0,0,0,0,0,25100,0,25101,25100,0,0,0,0,25097,25096,0,25097,0,0,0,25096,0,
+0,0,0,0,0,0,0,0,0,25093,8192,0,25093,0,0,0,8192,0,25089,0,0,0,0,0,
+25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26116,0,26128,9276,0,0,0,0,
+26113,18434,0,9273,0,25112,0,17976,0,0,0,0,0,25136,0,0,0,0,26132,26116,0,26128,0,25104,
+0,26116,0,18450,0,25104,0,0,25104,17969,17456,0,0,25136,0,25136,25136,0,0,0,0,0,0,0,
+0,9268,0,0,0,0,0,17922,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+18946,18434,0,8192,0,8192,0,17964,0,18434,0,25096,0,0,8192,17961,17448,0,0,25120,0,8192,8192,0,
+0,0,0,9255,0,9254,0,0,8192,17952,17440,0,0,0,9250,0,0,0,17440,0,16928,25120,25120,0,
+8192,0,8192,0,25120,0,0,17922,0,8192,8192,0,0,0,0,25089,17410,0,8192,0,0,0,16928,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,17922,0,25089,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,25093,25092,0,0,0,0,25089,17410,0,
+25089,0,0,0,16928,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,26129,18450,0,26128,0,25112,
+0,17948,0,26113,0,25112,0,0,25112,26113,17432,0,0,25104,0,25104,25104,0,0,0,0,26128,0,25104,
+0,0,25104,26128,17424,0,0,0,25104,0,0,0,17424,0,25104,25104,25104,0,25104,0,25104,0,25104,0,
+0,17942,0,25089,9236,0,0,0,0,25089,17410,0,25089,0,0,0,16912,0,0,0,0,0,25104,0,
+0,0,0,9231,0,25096,0,0,8192,17928,17416,0,0,0,25096,0,0,0,17416,0,25096,9227,9226,0,
+8192,0,8192,0,16904,0,0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,
+8192,0,8192,0,0,8192,8192,8192,0,25089,17410,0,8192,0,0,0,16900,0,25089,0,0,0,0,0,
+25089,16384,0,0,16898,0,8192,8192,0,0,0,0,0,25092,0,25093,25092,0,0,0,0,25089,17410,0,
+25089,0,0,0,16904,0,0,0,0,0,0,0,0,0,0,25093,25092,0,25093,0,0,0,25092,0,
+25089,0,0,0,0,0,25089,16384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,16898,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,0,0,0,0,17922,0,9241,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,25092,25092,0,0,0,0,17939,17410,0,9233,0,25104,0,16912,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25092,0,8192,8192,0,0,0,0,17922,17410,0,8192,0,8192,0,16904,0,
+0,0,0,0,0,0,0,0,0,25092,25092,0,8192,0,8192,0,25092,0,17410,0,16898,0,0,8192,
+16897,16384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,16898,0,
+8192,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,
+0,0,0,0,16898,0,25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25152,0,0,0,0,0,25152,0,25152,8192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25152,0,25152,25152,0,0,0,0,25152,25152,0,25152,0,25168,0,25168,0,0,0,0,
+0,25184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25152,0,25152,25152,0,0,0,0,25152,25152,0,25152,0,25152,
+0,25152,0,0,0,0,0,25184,0,0,0,0,25152,25152,0,25152,0,25152,0,25152,0,25152,0,25152,
+0,0,25152,25152,25152,0,0,25184,0,25184,25184,0,0,0,0,0,0,0,0,25152,0,0,0,0,
+0,25152,0,25152,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25152,0,0,0,0,0,25154,0,25153,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25152,0,25152,25152,0,0,0,0,25152,25152,0,25152,0,25168,0,25168,0,0,0,0,
+0,25152,0,0,0,0,25152,25152,0,25152,0,25168,0,25168,0,25152,0,25168,0,0,25168,25168,25168,0,
+0,25152,0,25152,25152,0,0,0,0,0,0,0,0,25152,0,0,0,0,0,25152,0,25152,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,25152,25152,0,25152,0,25152,0,25152,0,25152,0,25152,
+0,0,25152,25152,25152,0,0,25152,0,25152,25152,0,0,0,0,8192,0,8192,0,0,8192,8192,8192,0,
+0,0,8192,0,0,0,8192,0,8192,8192,8192,0,8192,0,8192,0,8192,0,0,25152,0,25152,25152,0,
+0,0,0,25152,25152,0,25152,0,25152,0,25152,0,0,0,0,0,25152,0,0,0,0,0,0,0,
+0,25152,0,0,0,0,0,25154,0,25153,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25154,0,25153,25152,0,0,0,0,25155,25154,0,25153,0,0,0,0,0,0,0,0,0,25152,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,25156,0,0,0,0,0,25152,0,25152,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25156,0,0,0,0,
+0,25152,0,25152,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25156,0,25156,25156,0,
+0,0,0,25152,25152,0,25152,0,25152,0,25152,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,10248,0,18949,9276,0,0,0,0,26128,9274,0,9273,0,25104,
+0,25104,0,0,0,0,0,25120,0,0,0,0,10241,8192,0,10241,0,25104,0,8192,0,9267,0,25104,
+0,0,25104,25104,8192,0,0,8192,0,25120,8192,0,0,0,0,0,0,0,0,17924,0,0,0,0,
+0,9266,0,9265,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,18948,9262,0,18436,0,17924,
+0,9260,0,8192,0,8192,0,0,8192,8192,8192,0,0,25120,0,25120,25120,0,0,0,0,9255,0,9254,
+0,0,9252,9253,8192,0,0,0,8192,0,0,0,8192,0,8192,25120,8192,0,25120,0,25120,0,8192,0,
+0,17924,0,17924,17412,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,25120,0,
+0,0,0,0,0,0,0,9260,0,0,0,0,0,25090,0,25089,8192,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,8192,0,25089,8192,0,0,0,0,25091,8192,0,25089,0,0,0,0,0,
+0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,26128,10248,0,10269,0,25104,0,25104,0,26128,0,25104,
+0,0,25104,25104,25104,0,0,17928,0,17945,17416,0,0,0,0,9239,0,25104,0,0,25104,25104,8192,0,
+0,0,25104,0,0,0,25104,0,25104,9235,8192,0,9233,0,25104,0,8192,0,0,17942,0,17941,17412,0,
+0,0,0,26128,9234,0,9233,0,25104,0,25104,0,0,0,0,0,16912,0,0,0,0,9231,0,9230,
+0,0,9228,9229,9228,0,0,0,8192,0,0,0,8192,0,8192,17928,17416,0,17416,0,16904,0,16904,0,
+0,0,8192,0,0,0,8192,0,8192,0,0,0,0,0,0,0,0,8192,8192,0,8192,0,0,8192,
+8192,8192,0,17924,17412,0,17412,0,16900,0,16900,0,8192,0,8192,0,0,8192,8192,8192,0,0,16898,0,
+16897,16384,0,0,0,0,0,25090,0,25089,9228,0,0,0,0,25091,25090,0,25089,0,0,0,0,0,
+0,0,0,0,16904,0,0,0,0,25091,8192,0,25089,0,0,0,0,0,25091,0,0,0,0,0,
+0,0,0,0,8192,0,25089,8192,0,0,0,0,0,0,0,0,16900,0,0,0,0,0,25090,0,
+25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,
+0,9242,0,9241,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,25092,8192,0,
+0,0,0,9235,8192,0,9233,0,25104,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,25092,0,25092,25092,0,0,0,0,8192,8192,0,8192,0,8192,0,8192,0,0,0,0,0,0,0,
+0,0,0,25092,8192,0,25092,0,25092,0,8192,0,8192,0,8192,0,0,8192,8192,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,25092,0,0,0,0,0,8192,0,8192,8192,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8192,0,0,0,0,0,8192,0,
+25089,8192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,
+}
+};
+
+#endif
@@ -0,0 +1,38 @@
+#!/bin/sh
+# Protocol test for the headless engine: positions that can't come up in a game are reported as errors,
+# the process keeps going and the next good position is searched as usual
+# Run (after building the engine, see engine.c):  sh test_engine.sh [./engine]
+ENGINE=${1:-./engine}
+
+out=$(printf '%s\n' \
+    "position XX......." "go" \
+    "position X........ turn x" "go" \
+    "position OOX...... turn o" "go" \
+    "position XXXOO...." "go" \
+    "position XXXOOO..." "go" \
+    "position X...O...X" "go" \
+    "isready" "quit" | "$ENGINE")
+status=$?
+
+fail=0
+check() { # check <expected count> <pattern>
+    got=$(printf '%s\n' "$out" | grep -c -- "$2")
+    if [ "$got" -ne "$1" ]; then
+        echo "expected $1 line(s) matching '$2', got $got"
+        fail=1
+    fi
+}
+check 3 "info string error: mark counts don't fit the side to move"
+check 2 "info string error: game is already decided"
+check 6 "^bestmove [0-2] [0-2]$" # every go still answers, from the last accepted position
+check 1 "^readyok$"
+if [ "$status" -ne 0 ]; then
+    echo "engine exited with status $status"
+    fail=1
+fi
+
+if [ "$fail" -ne 0 ]; then
+    printf '%s\n' "$out"
+    exit 1
+fi
+echo "engine protocol test passed"
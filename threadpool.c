@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include "threadpool.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#define MAX_WORKERS 64
+#define MAX_DEQUES (MAX_WORKERS + 16) // the workers' and one per outside thread that spawns or waits
+#define DEQUE_SIZE 1024 // power of two
+
+typedef struct {
+    TaskFn fn;
+    void *arg;
+    TaskGroup *group;
+} Task;
+
+// Slots 1..threadCount-1 are the workers. Slot 0 belongs to the thread that called poolInit(); every other
+// thread outside the pool (the AI worker next to the game loop, say) claims one of the rest the first time it
+// spawns or waits, so no two threads ever pop from the same bottom
+typedef struct {
+    pthread_mutex_t lock;
+    Task tasks[DEQUE_SIZE];
+    long top, bottom; // steal at top, push/pop at bottom
+} Deque;
+
+static Deque deques[MAX_DEQUES];
+static pthread_t workers[MAX_WORKERS];
+static int threadCount = 0;   // workers + the calling thread, 0 before poolInit()
+static atomic_int dequeCount; // slots handed out
+static atomic_int generation; // bumped by poolInit(), so slots claimed before a poolShutdown() are claimed again
+static atomic_int queuedTasks;
+static atomic_int stopping;
+static pthread_mutex_t idleLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idleCond = PTHREAD_COND_INITIALIZER;
+static pthread_mutex_t initLock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local int workerIndex = -1; // this thread's deque, -1 if it has none (yet)
+static _Thread_local int workerGeneration = 0;
+
+int cpuCoreCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+static int pushTask(Deque *d, Task task) {
+    pthread_mutex_lock(&d->lock);
+    int ok = d->bottom - d->top < DEQUE_SIZE;
+    if (ok) d->tasks[d->bottom++ & (DEQUE_SIZE - 1)] = task;
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static int popTask(Deque *d, Task *task) {
+    pthread_mutex_lock(&d->lock);
+    int ok = d->bottom > d->top;
+    if (ok) *task = d->tasks[--d->bottom & (DEQUE_SIZE - 1)];
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+// The oldest task, if group is NULL or it belongs to group
+static int stealTask(Deque *d, Task *task, const TaskGroup *group) {
+    pthread_mutex_lock(&d->lock);
+    int ok = d->bottom > d->top && (!group || d->tasks[d->top & (DEQUE_SIZE - 1)].group == group);
+    if (ok) *task = d->tasks[d->top++ & (DEQUE_SIZE - 1)];
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static void runTask(Task task) {
+    atomic_fetch_sub(&queuedTasks, 1);
+    task.fn(task.arg);
+    atomic_fetch_sub(&task.group->pending, 1);
+}
+
+// This thread's slot, claimed on first use. -1 once they have all been handed out: the thread then runs what
+// it spawns right away
+static int ownDeque(void) {
+    int gen = atomic_load(&generation);
+    if (workerGeneration != gen) {
+        workerGeneration = gen;
+        workerIndex = atomic_fetch_add(&dequeCount, 1);
+        if (workerIndex >= MAX_DEQUES) workerIndex = -1;
+    }
+    return workerIndex;
+}
+
+// Own deque first (newest task, best cache locality), then steal the oldest task of another deque. A waiter
+// (group set) only steals tasks of the group it waits for: anything else could be another thread's long job
+static int findTask(Task *task, const TaskGroup *group) {
+    int self = ownDeque();
+    if (self >= 0 && popTask(&deques[self], task)) return 1;
+    int count = atomic_load(&dequeCount);
+    if (count > MAX_DEQUES) count = MAX_DEQUES;
+    for (int i = 1; i <= count; i++) {
+        int victim = (self + i + count) % count;
+        if (victim != self && stealTask(&deques[victim], task, group)) return 1;
+    }
+    return 0;
+}
+
+static void *workerMain(void *arg) {
+    workerIndex = (int)(long)arg;
+    workerGeneration = atomic_load(&generation);
+    Task task;
+    while (!atomic_load(&stopping)) {
+        if (findTask(&task, NULL)) {
+            runTask(task);
+            continue;
+        }
+        pthread_mutex_lock(&idleLock);
+        while (atomic_load(&queuedTasks) == 0 && !atomic_load(&stopping))
+            pthread_cond_wait(&idleCond, &idleLock);
+        pthread_mutex_unlock(&idleLock);
+    }
+    return NULL;
+}
+
+void poolInit(int threads) {
+    pthread_mutex_lock(&initLock);
+    if (threadCount == 0) {
+        if (threads <= 0) threads = cpuCoreCount();
+        if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+        for (int i = 0; i < MAX_DEQUES; i++) {
+            pthread_mutex_init(&deques[i].lock, NULL);
+            deques[i].top = deques[i].bottom = 0;
+        }
+        atomic_store(&stopping, 0);
+        atomic_store(&dequeCount, threads);
+        workerIndex = 0; // slot 0 is the caller's
+        workerGeneration = atomic_fetch_add(&generation, 1) + 1;
+        threadCount = threads;
+        for (int i = 1; i < threads; i++)
+            pthread_create(&workers[i], NULL, workerMain, (void *)(long)i);
+    }
+    pthread_mutex_unlock(&initLock);
+}
+
+int poolThreadCount(void) {
+    return threadCount;
+}
+
+void poolShutdown(void) {
+    pthread_mutex_lock(&initLock);
+    if (threadCount > 0) {
+        pthread_mutex_lock(&idleLock);
+        atomic_store(&stopping, 1);
+        pthread_cond_broadcast(&idleCond);
+        pthread_mutex_unlock(&idleLock);
+        for (int i = 1; i < threadCount; i++)
+            pthread_join(workers[i], NULL);
+        for (int i = 0; i < MAX_DEQUES; i++) pthread_mutex_destroy(&deques[i].lock);
+        threadCount = 0;
+    }
+    pthread_mutex_unlock(&initLock);
+}
+
+void taskGroupInit(TaskGroup *group) {
+    atomic_init(&group->pending, 0);
+}
+
+void poolSpawn(TaskGroup *group, TaskFn fn, void *arg) {
+    Task task = { fn, arg, group };
+    atomic_fetch_add(&group->pending, 1);
+    atomic_fetch_add(&queuedTasks, 1);
+    int self = threadCount ? ownDeque() : -1;
+    if (self < 0 || !pushTask(&deques[self], task)) {
+        runTask(task); // no pool, no slot left or deque full: run it right here
+        return;
+    }
+    pthread_mutex_lock(&idleLock);
+    pthread_cond_signal(&idleCond);
+    pthread_mutex_unlock(&idleLock);
+}
+
+// Help out until the group is done: run our own tasks first, then steal the group's
+void poolWait(TaskGroup *group) {
+    Task task;
+    while (atomic_load(&group->pending) > 0) {
+        if (threadCount && findTask(&task, group)) runTask(task);
+        else sched_yield();
+    }
+}
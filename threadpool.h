@@ -0,0 +1,27 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <stdatomic.h>
+
+// Work-stealing thread pool shared by the parallel searches.
+// Every worker owns a deque: it pushes and pops its own tasks at the bottom, idle workers steal from the top.
+// A thread that waits on a group keeps running tasks instead of blocking, so nested spawn/wait is fine: the ones
+// it spawned itself, and the group's from other deques. Threads outside the pool get a deque of their own too.
+
+typedef void (*TaskFn)(void *arg);
+
+// Tasks spawned into a group; poolWait() returns once all of them have finished
+typedef struct {
+    atomic_int pending;
+} TaskGroup;
+
+void poolInit(int threads);  // threads <= 0: one per core. Later calls are ignored
+int poolThreadCount(void);   // workers + the calling thread
+int cpuCoreCount(void);
+void poolShutdown(void);
+
+void taskGroupInit(TaskGroup *group);
+void poolSpawn(TaskGroup *group, TaskFn fn, void *arg);
+void poolWait(TaskGroup *group);
+
+#endif
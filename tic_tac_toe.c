@@ -1,309 +1,509 @@
 #include "raylib.h"
-#include "minimax.h"
+#include "ai_worker.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 #include "ui.h"
+#include "asset_pack.h"
+#include "threadpool.h"
+#include "game_log.h"
+
+#define SCREEN_SIZE 600
+#define TARGET_FPS 60
+
+typedef enum { MENU, SINGLEPLAYER_CHOICE, STARTER_SELECT, DIFFICULTY_SELECT, BOARD_SELECT, PLAYING, GAMEOVER, PAUSE } GameState;
+typedef enum { TWO_PLAYER, SINGLE_PLAYER_MM, SINGLE_PLAYER_NB, SINGLE_PLAYER_MCTS } GameMode;
+
+// Board variants offered in BOARD_SELECT: width, height, k in a row
+static const int boardVariants[4][3] = { {3, 3, 3}, {4, 4, 4}, {5, 5, 4}, {7, 7, 5} };
+
+// Startup assets. From assets.pak (written by pack_assets.c) they are already decoded, and the mapping goes
+// straight to the GPU and the audio device. Without a pack the original files are decoded on a pool thread
+// while the menu is already on screen, and show up once they are ready
+enum { ASSET_BACKGROUND, ASSET_GAMEOVER, ASSET_CLICK, ASSET_COUNT };
+static const char *const assetFiles[ASSET_COUNT] = { "Graphics/background.png", "Graphics/gameover.png", "Audio/clicknew.mp3" };
+
+typedef struct {
+    Texture2D background, gameover;
+    Sound click;
+    int loaded;
+} GameAssets;
+
+// Fallback decoding, filled in on a pool thread
+typedef struct {
+    char paths[ASSET_COUNT][512];
+    Image background, gameover;
+    Wave click;
+} DecodeJob;
+
+// Next to the executable, so the game starts from any working directory; else relative to the working directory
+static void assetPath(char *out, size_t size, const char *name) {
+    snprintf(out, size, "%s%s", GetApplicationDirectory(), name);
+    if (!FileExists(out)) snprintf(out, size, "%s", name);
+}
 
-#define SIZE 3
-#define CELL_SIZE 200
-#define SCREEN_SIZE (CELL_SIZE * SIZE)
+static Image packedImage(const AssetPack *pack, const char *name) {
+    const AssetEntry *e = assetPackFind(pack, name);
+    if (!e || e->kind != ASSET_IMAGE) return (Image){ 0 };
+    return (Image){ .data = (void *)assetPackData(pack, e), .width = e->width, .height = e->height, .mipmaps = 1,
+                    .format = e->format };
+}
 
-typedef enum { MENU, SINGLEPLAYER_CHOICE, STARTER_SELECT, DIFFICULTY_SELECT, PLAYING, GAMEOVER, PAUSE } GameState;
-typedef enum { TWO_PLAYER, SINGLE_PLAYER_MM, SINGLE_PLAYER_NB } GameMode;
+static Wave packedWave(const AssetPack *pack, const char *name) {
+    const AssetEntry *e = assetPackFind(pack, name);
+    if (!e || e->kind != ASSET_SOUND) return (Wave){ 0 };
+    return (Wave){ .frameCount = e->frameCount, .sampleRate = e->sampleRate, .sampleSize = 16, .channels = e->channels,
+                   .data = (void *)assetPackData(pack, e) };
+}
 
-int checkWin(char board[3][3]) {
-    for (int i = 0; i < 3; i++) {
-        // Check rows
-        if (board[i][0] != ' ' &&
-            board[i][0] == board[i][1] &&
-            board[i][1] == board[i][2])
-            return board[i][0];
-
-        // Check columns
-        if (board[0][i] != ' ' &&
-            board[0][i] == board[1][i] &&
-            board[1][i] == board[2][i])
-            return board[0][i];
+// Returns 0 if there is no pack or it lacks one of the assets
+static int loadPackedAssets(GameAssets *assets, const char *path) {
+    AssetPack pack;
+    if (!assetPackMap(&pack, path)) return 0;
+    Image background = packedImage(&pack, assetFiles[ASSET_BACKGROUND]);
+    Image gameover = packedImage(&pack, assetFiles[ASSET_GAMEOVER]);
+    Wave click = packedWave(&pack, assetFiles[ASSET_CLICK]);
+    int complete = background.data && gameover.data && click.data;
+    if (complete) {
+        assets->background = LoadTextureFromImage(background);
+        assets->gameover = LoadTextureFromImage(gameover);
+        assets->click = LoadSoundFromWave(click);
+        assets->loaded = 1;
     }
+    assetPackUnmap(&pack); // the textures and the sound have their own copies
+    return complete;
+}
 
-    // Check diagonals
-    if (board[0][0] != ' ' &&
-        board[0][0] == board[1][1] &&
-        board[1][1] == board[2][2])
-        return board[0][0];
+static void decodeAssets(void *arg) {
+    DecodeJob *job = arg;
+    job->background = LoadImage(job->paths[ASSET_BACKGROUND]);
+    job->gameover = LoadImage(job->paths[ASSET_GAMEOVER]);
+    job->click = LoadWave(job->paths[ASSET_CLICK]);
+}
 
-    if (board[0][2] != ' ' &&
-        board[0][2] == board[1][1] &&
-        board[1][1] == board[2][0])
-        return board[0][2];
+// Game loop thread: textures and sounds can only be created here
+static void uploadDecodedAssets(GameAssets *assets, DecodeJob *job) {
+    assets->background = LoadTextureFromImage(job->background);
+    assets->gameover = LoadTextureFromImage(job->gameover);
+    assets->click = LoadSoundFromWave(job->click);
+    UnloadImage(job->background);
+    UnloadImage(job->gameover);
+    UnloadWave(job->click);
+    assets->loaded = 1;
+}
 
-    return 0;  // no winner
+// Boards are row-major, rules.width * rules.height cells
+int checkWin(const MnkRules *rules, const char *board) {
+    return mnkWinner(rules, board);  // no winner returns 0
 }
 
-int isDraw(char board[SIZE][SIZE]) {
-    for (int i = 0; i < SIZE; i++)
-        for (int j = 0; j < SIZE; j++)
-            if (board[i][j] == ' ')
-                return 0;
+int isDraw(const MnkRules *rules, const char *board) {
+    for (int i = 0; i < rules->cells; i++)
+        if (board[i] == ' ')
+            return 0;
     return 1;
 }
 
+// A finished game goes to the game log: what kind of game it was and its moves in order
+static void logFinishedGame(GameRecord *played, GameMode mode, int difficulty, const MnkRules *rules, const char *board) {
+    played->mode = (unsigned char)mode;
+    played->difficulty = (unsigned char)((mode == TWO_PLAYER) ? 0 : difficulty);
+    played->firstMark = board[played->moves[0]];
+    played->width = (unsigned char)rules->width;
+    played->height = (unsigned char)rules->height;
+    played->k = (unsigned char)rules->k;
+    gameLogAppend(played);
+}
+
+// Button definitions
+#define BUTTON_SPACING 110
+static const Rectangle btn1 = { SCREEN_SIZE/2 - 90, 250, 200, 60 };
+static const Rectangle btn2 = { SCREEN_SIZE/2 - 90, 250 + BUTTON_SPACING, 200, 60 };
+static const Rectangle btn3 = { SCREEN_SIZE/2 - 90, 250 + BUTTON_SPACING * 2, 200, 60 };
+static const Rectangle boardBtns[4] = {
+    { SCREEN_SIZE/2 - 210, 250, 200, 60 }, { SCREEN_SIZE/2 + 10, 250, 200, 60 },
+    { SCREEN_SIZE/2 - 210, 250 + BUTTON_SPACING, 200, 60 }, { SCREEN_SIZE/2 + 10, 250 + BUTTON_SPACING, 200, 60 }
+};
+
+// Button labels per screen, also baked into the UI atlas at startup
+static const char *const menuLabels[] = { "Two Player", "Single Player" };
+static const char *const modelLabels[] = { "Minimax", "Naive Bayes", "MCTS" };
+static const char *const starterLabels[] = { "You Start", "AI Starts" };
+static const char *const difficultyLabels[] = { "Easy", "Medium", "Hard" };
+static const char *const pauseLabels[] = { "Continue", "Restart", "Menu" };
+
+// Pre-render the buttons, their labels and the marks of every board size into the UI atlas
+static void buildAtlas(void) {
+    for (int i = 0; i < 2; i++) {
+        AddAtlasText(menuLabels[i], 28, BLACK);
+        AddAtlasText(starterLabels[i], 28, BLACK);
+    }
+    for (int i = 0; i < 3; i++) {
+        AddAtlasText(modelLabels[i], 28, BLACK);
+        AddAtlasText(difficultyLabels[i], 28, BLACK);
+        AddAtlasText(pauseLabels[i], 30, BLACK);
+    }
+    for (int i = 0; i < 4; i++) {
+        int longest = boardVariants[i][0] > boardVariants[i][1] ? boardVariants[i][0] : boardVariants[i][1];
+        int markSize = SCREEN_SIZE / longest / 5; // as in drawScene
+        AddAtlasText(TextFormat("%d x %d", boardVariants[i][0], boardVariants[i][1]), 28, BLACK);
+        AddAtlasText("X", markSize, WHITE);
+        AddAtlasText("O", markSize, BLACK);
+    }
+    BuildUIAtlas(btn1.width, btn1.height);
+}
+
+// The clickable buttons of a screen, returns how many
+static int screenButtons(GameState state, Rectangle *out) {
+    switch (state) {
+    case MENU: case STARTER_SELECT:
+        out[0] = btn1; out[1] = btn2;
+        return 2;
+    case SINGLEPLAYER_CHOICE: case DIFFICULTY_SELECT: case PAUSE:
+        out[0] = btn1; out[1] = btn2; out[2] = btn3;
+        return 3;
+    case BOARD_SELECT:
+        for (int i = 0; i < 4; i++) out[i] = boardBtns[i];
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+// Index of the button under the mouse, -1 if none
+static int hoveredButton(GameState state, Vector2 mouse) {
+    Rectangle buttons[4];
+    int count = screenButtons(state, buttons);
+    for (int i = 0; i < count; i++)
+        if (CheckCollisionPointRec(mouse, buttons[i])) return i;
+    return -1;
+}
+
+// Everything the cached layer shows. It is compared byte for byte every frame, so clear it before filling it in
+typedef struct {
+    GameState state;
+    GameMode mode;
+    int hovered;
+    int width, height, cellSize;
+    char board[MNK_MAX_CELLS];
+    int gameOver;
+    char winner, currentPlayer;
+    int assetsLoaded; // the background and game over images appear when they are
+} Scene;
+
+static void drawMenuButtons(const Scene *s, const char *const *labels, int fontSize) {
+    Rectangle buttons[4];
+    int count = screenButtons(s->state, buttons);
+    for (int i = 0; i < count; i++) {
+        DrawButton(buttons[i], s->hovered == i);
+        if (labels) DrawCenteredTextInButton(buttons[i], labels[i], fontSize, BLACK);
+    }
+}
+
+// Draw the static part of a screen: background, texts, buttons, grid and marks. Only runs when the Scene changed
+static void drawScene(const Scene *s, Texture2D background, Texture2D gameovertext) {
+    ClearBackground(WHITE);
+    DrawTexture(background, 0, 0, WHITE);
+
+    //state machine for start menu choosing
+    if (s->state == MENU) {
+        DrawText("TIC TAC TOE", SCREEN_SIZE/2 - 138, 102, 40, DARKGRAY); //shadow effect 
+        DrawText("TIC TAC TOE", SCREEN_SIZE/2 - 140, 100, 40, BLACK); 
+        DrawText("Click to choose mode:", SCREEN_SIZE/2 - 150, 200, 30, GREEN);
+        drawMenuButtons(s, menuLabels, 28);
+    }
+
+    else if (s->state == SINGLEPLAYER_CHOICE){
+        DrawText("Select an AI model to play against", SCREEN_SIZE/2 - 250 , 100, 30, GREEN);
+        drawMenuButtons(s, modelLabels, 28);
+    }
+
+    // this else if is for option of who starts first
+    else if (s->state == STARTER_SELECT) {
+        DrawText("Single Player Mode", SCREEN_SIZE/2 - 148, 102, 30, DARKGRAY); //shadow effect
+        DrawText("Single Player Mode", SCREEN_SIZE/2 - 150, 100, 30, BLACK);
+        DrawText("Who should start first?", SCREEN_SIZE/2 - 150, 180, 28, GREEN);
+        drawMenuButtons(s, starterLabels, 28);
+    }
+
+    else if (s->state == DIFFICULTY_SELECT && s->mode != SINGLE_PLAYER_NB) {
+        DrawText("Select AI Difficulty", SCREEN_SIZE/2 - 150, 100, 30, GREEN);
+        drawMenuButtons(s, NULL, 0);
+        DrawUIText(difficultyLabels[0], btn1.x + 70, btn1.y + 15, 28, BLACK);
+        DrawUIText(difficultyLabels[1], btn2.x + 60, btn2.y + 15, 28, BLACK);
+        DrawUIText(difficultyLabels[2], btn3.x + 70, btn3.y + 15, 28, BLACK);
+    }
+
+    else if (s->state == BOARD_SELECT) {
+        DrawText("Select board size", SCREEN_SIZE/2 - 130, 100, 30, GREEN);
+        DrawText("4x4: 4 in a row   5x5: 4 in a row   7x7: 5 in a row", SCREEN_SIZE/2 - 250, 180, 20, DARKGRAY);
+        drawMenuButtons(s, NULL, 0);
+        for (int i = 0; i < 4; i++)
+            DrawCenteredTextInButton(boardBtns[i], TextFormat("%d x %d", boardVariants[i][0], boardVariants[i][1]), 28, BLACK);
+    }
+
+    else if (s->state == PLAYING){
+        int cellSize = s->cellSize;
+        // Draw grid
+        for (int i = 1; i < s->height; i++)
+            DrawLine(0, i * cellSize, s->width * cellSize, i * cellSize, BLACK);
+        for (int i = 1; i < s->width; i++)
+            DrawLine(i * cellSize, 0, i * cellSize, s->height * cellSize, BLACK);
+
+        // Draw marks, scaled with the cell (40px on the 3x3 board)
+        int markSize = cellSize / 5;
+        for (int i = 0; i < s->height; i++) {
+            for (int j = 0; j < s->width; j++) {
+                int x = j * cellSize + cellSize / 2;
+                int y = i * cellSize + cellSize / 2;
+                if (s->board[i * s->width + j] == 'X')
+                    DrawUIText("X", x - markSize / 2, y - markSize / 2, markSize, WHITE);
+                else if (s->board[i * s->width + j] == 'O')
+                    DrawUIText("O", x - markSize / 2, y - markSize / 2, markSize, BLACK);
+            }
+        }
+
+        if (s->gameOver) {
+            DrawTexture(gameovertext, -80, 0, WHITE);
+
+            if (s->winner)
+                DrawText(TextFormat("Player %c Wins!", s->winner), SCREEN_SIZE/2 - 110, 400, 30, GREEN);
+            else
+                DrawText("It's a Draw!", SCREEN_SIZE/2 - 110, 400, 30, WHITE);
+
+            DrawText("Press R to restart or M for menu", SCREEN_SIZE/2 - 170, 450, 20, BLACK);
+        } else {
+            DrawText(TextFormat("Player %c's turn", s->currentPlayer), 10, SCREEN_SIZE + 10, 30, BLUE);
+        }
+    }
+    // Pause State 
+    else if (s->state == PAUSE){
+        // Background dim
+        DrawRectangle(0, 0, SCREEN_SIZE, SCREEN_SIZE, (Color){0,0,0,150});
+        DrawText("Paused",SCREEN_SIZE/2 - MeasureText("Paused", 50)/2, 150, 50,WHITE);
+        drawMenuButtons(s, pauseLabels, 30);
+    }
+}
+
 int main(void) {
+    unsigned long long launchNs = metricsNowNs(); // time to first frame is measured from here
     InitWindow(SCREEN_SIZE, SCREEN_SIZE, "Tic Tac Toe GUI - raylib");
+    SetTargetFPS(TARGET_FPS); // never spin faster than the display needs
     InitAudioDevice();
     InitUI();
+    buildAtlas(); // buttons, labels and marks become single textured quads
+    int showMetrics = metricsSinkFromEnv(); // per-move engine statistics only when TTT_METRICS is set
+    aiWorkerStart((unsigned long long)time(NULL)); // AI moves are computed off the render thread
+    gameLogOpen(getenv("TTT_GAME_LOG") ? getenv("TTT_GAME_LOG") : "games.log"); // every finished game, see game_log.h
 
     GameState state = MENU;
     GameMode mode = TWO_PLAYER;
 
-    char board[SIZE][SIZE];
-    for (int i = 0; i < SIZE; i++)
-        for (int j = 0; j < SIZE; j++)
-            board[i][j] = ' ';
+    // Board size and win length; the grid, win checks and the AI all follow these rules
+    MnkRules rules;
+    mnkInitRules(&rules, 3, 3, 3);
+    int cellSize = SCREEN_SIZE / 3;
+
+    char board[MNK_MAX_CELLS];
+    memset(board, ' ', sizeof(board));
+    static GameRecord played; // moves of the game on the board, for the game log
+    // Larger boards search on every core; a new seed per move keeps the tie-breaks varied
+    MnkOptions searchOptions = { 1, (unsigned long long)time(NULL), NULL, 0, 0, 0 };
 
     char currentPlayer = 'X';
+    int newGame = 1; // the next AI request starts with an empty transposition table
+    double aiRequestTime = 0;
     int gameOver = 0;
     char winner = 0;
     // to track who starts, player = 1, ai =
     int playerStarts = 1; 
     int difficulty = 3;
-    //Load textures 
-    Texture2D gamebackground = LoadTexture("Graphics/background.png");
-    Texture2D gameovertext = LoadTexture("Graphics/gameover.png");
-    // Button definitions
-    int buttonSpacing = 110;
-
-    Rectangle btn1 = { SCREEN_SIZE/2 - 90, 250, 200, 60 };
-    Rectangle btn2 = { SCREEN_SIZE/2 - 90, 250 + buttonSpacing, 200, 60 };
-    Rectangle btn3 = { SCREEN_SIZE/2 - 90, 250 + buttonSpacing * 2, 200, 60 };
+    // Textures and sounds: from the asset pack if there is one, otherwise decoded behind the first frames
+    GameAssets assets;
+    memset(&assets, 0, sizeof(assets));
+    static DecodeJob decodeJob;
+    TaskGroup decoding;
+    taskGroupInit(&decoding);
+    char packPath[512];
+    assetPath(packPath, sizeof(packPath), "assets.pak");
+    if (!loadPackedAssets(&assets, packPath)) {
+        for (int i = 0; i < ASSET_COUNT; i++) assetPath(decodeJob.paths[i], sizeof(decodeJob.paths[i]), assetFiles[i]);
+        poolInit(0);
+        poolSpawn(&decoding, decodeAssets, &decodeJob);
+    }
+    unsigned long long firstFrameNs = 0, assetsReadyNs = assets.loaded ? metricsNowNs() - launchNs : 0;
+
+    // Static layers (background, texts, buttons, grid, marks) are drawn into this texture and only redrawn when
+    // the Scene they show changes; every frame just copies it to the screen
+    RenderTexture2D layer = LoadRenderTexture(SCREEN_SIZE, SCREEN_SIZE);
+    Scene shown;
+    memset(&shown, 0, sizeof(shown));
+    shown.hovered = -2; // matches no real scene, so the first frame builds the layer
+    int waiting = 0;    // event waiting on: frames only happen on input
+    long frames = 0, layerBuilds = 0;
+    double startTime = GetTime();
     
-    // Load Music & Sounds 
-    Sound clicksound = LoadSound("Audio/clicknew.mp3");
+    // Naive Bayes model for SINGLE_PLAYER_NB: memory-map the compiled model (TTT_NB_MODEL picks another file).
+    // Without one, fit from tic-tac-toe.data once and save the model for the next start
+    const char *nbModelPath = getenv("TTT_NB_MODEL") ? getenv("TTT_NB_MODEL") : "tic-tac-toe.nbm";
+    static NaiveBayesModel nbTrained;
+    const NaiveBayesModel *nbModel = nbMapModel(nbModelPath);
+    if (!nbModel) {
+        if (nbTrain(&nbTrained, "tic-tac-toe.data")) nbSaveModel(&nbTrained, nbModelPath);
+        else printf("Naive Bayes model unavailable, its moves fall back to the first free cell\n");
+        nbModel = &nbTrained;
+    }
 
     while (!WindowShouldClose()) {
-        BeginDrawing();
-        DrawTexture(gamebackground, 0, 0, WHITE);
+        if (!assets.loaded && atomic_load(&decoding.pending) == 0) {
+            uploadDecodedAssets(&assets, &decodeJob);
+            assetsReadyNs = metricsNowNs() - launchNs;
+        }
+        Vector2 mouse = GetMousePosition();
+        int clicked = IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+        int pick = clicked ? hoveredButton(state, mouse) : -1; // button clicked this frame
 
         //state machine for start menu choosing
         if (state == MENU) {
-            DrawText("TIC TAC TOE", SCREEN_SIZE/2 - 138, 102, 40, DARKGRAY); //shadow effect 
-            DrawText("TIC TAC TOE", SCREEN_SIZE/2 - 140, 100, 40, BLACK); 
-            DrawText("Click to choose mode:", SCREEN_SIZE/2 - 150, 200, 30, GREEN);
-
-            bool hover1 = CheckCollisionPointRec(GetMousePosition(), btn1);
-            DrawButton(btn1, hover1);
-            bool hover2 = CheckCollisionPointRec(GetMousePosition(), btn2);
-            DrawButton(btn2, hover2);
-
-            DrawCenteredTextInButton(btn1, "Two Player", 28, BLACK);
-            DrawCenteredTextInButton(btn2, "Single Player", 28, BLACK);
-
-
-            Vector2 mouse = GetMousePosition();
-
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                if (CheckCollisionPointRec(mouse, btn1)) {
-                    mode = TWO_PLAYER;
-                    state = PLAYING;
-                } else if (CheckCollisionPointRec(mouse, btn2)) {
-                    // mode = SINGLE_PLAYER;
-                    state = SINGLEPLAYER_CHOICE;
-                }
+            if (pick == 0) {
+                mode = TWO_PLAYER;
+                state = BOARD_SELECT;
+            } else if (pick == 1) {
+                // mode = SINGLE_PLAYER;
+                state = SINGLEPLAYER_CHOICE;
             }
         }
 
         else if (state == SINGLEPLAYER_CHOICE){
-            DrawText("Select an AI model to play against", SCREEN_SIZE/2 - 250 , 100, 30, GREEN);
-
-            bool hover1 = CheckCollisionPointRec(GetMousePosition(), btn1);
-            DrawButton(btn1, hover1);
-            bool hover2 = CheckCollisionPointRec(GetMousePosition(), btn2);
-            DrawButton(btn2, hover2);
-
-            DrawCenteredTextInButton(btn1, "Minimax", 28, BLACK);
-            DrawCenteredTextInButton(btn2, "Naive Bayes", 28, BLACK);
-            Vector2 mouse = GetMousePosition();
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                if (CheckCollisionPointRec(mouse, btn1)) {
-                    state = STARTER_SELECT;
-                    mode = SINGLE_PLAYER_MM;
-                } else if (CheckCollisionPointRec(mouse, btn2)) {
-                    state = STARTER_SELECT;
-                    mode = SINGLE_PLAYER_NB;
-                }
+            if (pick == 0) {
+                state = STARTER_SELECT;
+                mode = SINGLE_PLAYER_MM;
+            } else if (pick == 1) {
+                state = STARTER_SELECT;
+                mode = SINGLE_PLAYER_NB;
+            } else if (pick == 2) {
+                state = STARTER_SELECT;
+                mode = SINGLE_PLAYER_MCTS;
             }
         }
         
         // this else if is for option of who starts first
         else if (state == STARTER_SELECT) {
-            DrawText("Single Player Mode", SCREEN_SIZE/2 - 148, 102, 30, DARKGRAY); //shadow effect
-            DrawText("Single Player Mode", SCREEN_SIZE/2 - 150, 100, 30, BLACK);
-            DrawText("Who should start first?", SCREEN_SIZE/2 - 150, 180, 28, GREEN);
-
-            bool hover1 = CheckCollisionPointRec(GetMousePosition(), btn1);
-            DrawButton(btn1, hover1);
-            bool hover2 = CheckCollisionPointRec(GetMousePosition(), btn2);
-            DrawButton(btn2, hover2);
-
-            DrawCenteredTextInButton(btn1, "You Start", 28, BLACK);
-            DrawCenteredTextInButton(btn2, "AI Starts", 28, BLACK);
-
-
-            Vector2 mouse = GetMousePosition();
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                if (CheckCollisionPointRec(mouse, btn1)) {
-                    playerStarts = 1;
-                    currentPlayer = 'X'; // player
-                    state = DIFFICULTY_SELECT;
-                } else if (CheckCollisionPointRec(mouse, btn2)) {
-                    playerStarts = 0;
-                    currentPlayer = 'O'; // AI
-                    state = DIFFICULTY_SELECT;
-                }
+            if (pick == 0) {
+                playerStarts = 1;
+                currentPlayer = 'X'; // player
+                state = DIFFICULTY_SELECT;
+            } else if (pick == 1) {
+                playerStarts = 0;
+                currentPlayer = 'O'; // AI
+                state = DIFFICULTY_SELECT;
             }
         }
 
         else if (state == DIFFICULTY_SELECT) {
             if (mode == SINGLE_PLAYER_NB){
                 difficulty = 0;
+                mnkInitRules(&rules, 3, 3, 3); // the Naive Bayes model is trained on 3x3 boards only
+                cellSize = SCREEN_SIZE / 3;
                 state = PLAYING;
             }
-            else{
-                DrawText("Select AI Difficulty", SCREEN_SIZE/2 - 150, 100, 30, GREEN);
-
-            bool hover1 = CheckCollisionPointRec(GetMousePosition(), btn1);
-            DrawButton(btn1, hover1);
-            bool hover2 = CheckCollisionPointRec(GetMousePosition(), btn2);
-            DrawButton(btn2, hover2);
-            bool hover3 = CheckCollisionPointRec(GetMousePosition(), btn3);
-            DrawButton(btn3, hover3);
-
-                DrawText("Easy", btn1.x + 70, btn1.y + 15, 28, BLACK);
-                DrawText("Medium", btn2.x + 60, btn2.y + 15, 28, BLACK);
-                DrawText("Hard", btn3.x + 70, btn3.y + 15, 28, BLACK);
-
-                Vector2 mouse = GetMousePosition();
-                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    if (CheckCollisionPointRec(mouse, btn1)) difficulty = 1;
-                    else if (CheckCollisionPointRec(mouse, btn2)) difficulty = 2;
-                    else if (CheckCollisionPointRec(mouse, btn3)) difficulty = 3;
-
-                    if (difficulty) state = PLAYING;              
-                }
+            else if (clicked) {
+                if (pick == 0) difficulty = 1;
+                else if (pick == 1) difficulty = 2;
+                else if (pick == 2) difficulty = 3;
+
+                if (difficulty) state = BOARD_SELECT;              
+            }
+        }
+
+        else if (state == BOARD_SELECT) {
+            if (pick >= 0) {
+                mnkInitRules(&rules, boardVariants[pick][0], boardVariants[pick][1], boardVariants[pick][2]);
+                int longest = (rules.width > rules.height) ? rules.width : rules.height;
+                cellSize = SCREEN_SIZE / longest;
+                memset(board, ' ', sizeof(board));
+                played.moveCount = 0;
+                state = PLAYING;
             }
-            
         }
 
         else if (state == PLAYING){
-            if (!gameOver && currentPlayer == 'O'){
+            if (!gameOver && currentPlayer == 'O' && mode != TWO_PLAYER){
                 //to make the ai start immeadiatly if player wants it to go first
-                if (mode == SINGLE_PLAYER_MM){
-                    Move best = findBestMove(board, difficulty);
-                    board[best.row][best.col] = 'O';
-                    winner = checkWin(board);
-                    if (winner || isDraw(board))
-                        gameOver = 1;
-                    else
-                        currentPlayer = 'X';
-                }
-                else if (mode == SINGLE_PLAYER_NB){
-                    char cmd[512];
-                    char buffer[64];
-                    char board_str[64] = "";
-                    char prediction[10] = {0};
-
-                    // Convert board to string
-                    for (int i = 0; i < SIZE; i++) {
-                        for (int j = 0; j < SIZE; j++) {
-                            char temp[2];
-                            temp[0] = (board[i][j] == ' ') ? 'B' : board[i][j];
-                            temp[1] = '\0';
-                            strcat(board_str, temp);
-                            if (j < SIZE - 1) strcat(board_str, ",");
-                        }
-                        if (i < SIZE - 1) strcat(board_str, ",");
-                    }
-
-                    snprintf(cmd, sizeof(cmd),
-                             "python -c \"import mlalgo,sys; pred, cur, peak, tt = mlalgo.main(sys.argv[1]); print(f'{pred} {cur} {peak} {tt}')\" \"%s\"",
-                             board_str);
-
-                    FILE *fp = popen(cmd, "r");
-                    int move = -1;
-                    long memory_current, memory_peak;
-                    double time_taken;
-                    if (fp) {
-                        if (fgets(buffer, sizeof(buffer), fp) != NULL) {
-                            // remove newline
-                            char *line = strchr(buffer, '\n');
-                            if (line) *line = '\0';
-
-                            sscanf(buffer, "%d %ld %ld %lf", &move, &memory_current, &memory_peak, &time_taken); // read move, memory usage and time taken
-                            printf("Current memory usage: %ld bytes; Peak memory usage: %ld bytes; Time taken: %.6lfs\n", memory_current, memory_peak, time_taken);
-                        }
-                        pclose(fp);
+                if (!aiThinking()) {
+                    // Hand the position to the worker; the answer is picked up on a later frame
+                    static AiRequest request;
+                    memcpy(request.board, board, sizeof(request.board));
+                    request.difficulty = difficulty;
+                    request.newGame = newGame;
+                    request.model = nbModel;
+                    if (mode == SINGLE_PLAYER_NB) {
+                        // In-process Naive Bayes using the model loaded at startup
+                        request.engine = AI_NAIVE_BAYES;
+                    } else if (mode == SINGLE_PLAYER_MCTS) {
+                        // Monte Carlo tree search on every board size; its trees carry over between turns
+                        request.engine = AI_MCTS;
+                        request.rules = rules;
+                        request.options = searchOptions;
+                        searchOptions.seed++;
+                    } else if (rules.width == SIZE && rules.height == SIZE && rules.k == SIZE) {
+                        // 3x3 keeps the dedicated engine (tablebase, transposition table); other boards use the m,n,k search
+                        request.engine = AI_MINIMAX;
+                    } else {
+                        request.engine = AI_MNK;
+                        request.rules = rules;
+                        request.options = searchOptions;
+                        request.options.timeLimitMs = searchTimeBudgetMs(request.difficulty); // bounded wait on big boards
+                        searchOptions.seed++;
                     }
+                    aiRequestMove(&request);
+                    aiRequestTime = GetTime();
+                    newGame = 0;
+                }
 
-                    // implement the changing of board based on prediction from python here
-                    board[move / SIZE][move % SIZE] = 'O';
-                    winner = checkWin(board);
-                    if (winner || isDraw(board))
+                Move best;
+                SearchStats stats;
+                if (aiPollMove(&best, &stats)) {
+                    const char *engineName = mode == SINGLE_PLAYER_NB ? "Naive Bayes" : mode == SINGLE_PLAYER_MCTS ? "MCTS"
+                                           : rules.cells == SIZE * SIZE ? "Minimax" : "m,n,k";
+                    metricsReport(engineName, &stats);
+                    board[best.row * rules.width + best.col] = 'O';
+                    played.moves[played.moveCount++] = (unsigned char)(best.row * rules.width + best.col);
+                    winner = checkWin(&rules, board);
+                    if (winner || isDraw(&rules, board)) {
                         gameOver = 1;
-                    else
+                        logFinishedGame(&played, mode, difficulty, &rules, board);
+                    } else {
                         currentPlayer = 'X';
+                    }
                 }
             }
 
             // Check if player made a winning move, if not game continues
-            if (!gameOver && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                Vector2 mouse = GetMousePosition();
-                int row = mouse.y / CELL_SIZE;
-                int col = mouse.x / CELL_SIZE;
-
-                if (row < SIZE && col < SIZE && board[row][col] == ' ') {
-                    board[row][col] = currentPlayer;
-                    winner = checkWin(board);
-                    if (winner || isDraw(board))
+            if (!gameOver && (mode == TWO_PLAYER || currentPlayer == 'X') && clicked) {
+                int row = mouse.y / cellSize;
+                int col = mouse.x / cellSize;
+
+                if (row < rules.height && col < rules.width && board[row * rules.width + col] == ' ') {
+                    board[row * rules.width + col] = currentPlayer;
+                    played.moves[played.moveCount++] = (unsigned char)(row * rules.width + col);
+                    winner = checkWin(&rules, board);
+                    if (winner || isDraw(&rules, board)) {
                         gameOver = 1;
-                    else
+                        logFinishedGame(&played, mode, difficulty, &rules, board);
+                    } else {
                         currentPlayer = (currentPlayer == 'X') ? 'O' : 'X';
                     }
+                    }
                 }
 
-
-            // Draw grid
-            for (int i = 1; i < SIZE; i++) {
-                DrawLine(0, i * CELL_SIZE, SCREEN_SIZE, i * CELL_SIZE, BLACK);
-                DrawLine(i * CELL_SIZE, 0, i * CELL_SIZE, SCREEN_SIZE, BLACK);
-            }
-
-            // Draw marks
-            for (int i = 0; i < SIZE; i++) {
-                for (int j = 0; j < SIZE; j++) {
-                    int x = j * CELL_SIZE + CELL_SIZE / 2;
-                    int y = i * CELL_SIZE + CELL_SIZE / 2;
-                    if (board[i][j] == 'X')
-                        DrawText("X", x - 20, y - 20, 40, WHITE);
-                    else if (board[i][j] == 'O')
-                        DrawText("O", x - 20, y - 20, 40, BLACK);
-                }
-            }
-
             if (gameOver) {
-                DrawTexture(gameovertext, -80, 0, WHITE);
-
-                if (winner)
-                    DrawText(TextFormat("Player %c Wins!", winner), SCREEN_SIZE/2 - 110, 400, 30, GREEN);
-                else
-                    DrawText("It's a Draw!", SCREEN_SIZE/2 - 110, 400, 30, WHITE);
-
-                DrawText("Press R to restart or M for menu", SCREEN_SIZE/2 - 170, 450, 20, BLACK);
-
                 if (IsKeyPressed(KEY_R)) {
-                    for (int i = 0; i < SIZE; i++)
-                        for (int j = 0; j < SIZE; j++)
-                            board[i][j] = ' ';
+                    memset(board, ' ', sizeof(board));
+                    played.moveCount = 0;
+                    aiCancel();
+                    newGame = 1; // new game, forget the previous game's positions
                     printf("\nCurrent player is: %d", playerStarts);
                     if (playerStarts == 0) {
                         currentPlayer = 'O'; // AI
@@ -315,15 +515,14 @@ int main(void) {
 
                 if (IsKeyPressed(KEY_M)){
                     state = MENU;
-                    for (int i = 0; i < SIZE; i++)
-                        for (int j = 0; j < SIZE; j++)
-                            board[i][j] = ' ';
+                    aiCancel();
+                    newGame = 1;
+                    memset(board, ' ', sizeof(board));
+                    played.moveCount = 0;
                     currentPlayer = 'X';
                     winner = 0;
                     gameOver = 0;
                 }
-            } else {
-                DrawText(TextFormat("Player %c's turn", currentPlayer), 10, SCREEN_SIZE + 10, 30, BLUE);
             }
 
             // Pause functionality
@@ -333,58 +532,102 @@ int main(void) {
         }
         // Pause State 
         else if (state == PAUSE){
-            // Background dim
-            DrawRectangle(0, 0, SCREEN_SIZE, SCREEN_SIZE, (Color){0,0,0,150});
-
-            Vector2 mouse = GetMousePosition();
-
-            bool hoverContinue = CheckCollisionPointRec(mouse, btn1);
-            bool hoverRestart  = CheckCollisionPointRec(mouse, btn2);
-            bool hoverMenu     = CheckCollisionPointRec(mouse, btn3);
-
-            DrawButton(btn1, hoverContinue);
-            DrawButton(btn2, hoverRestart);
-            DrawButton(btn3, hoverMenu);
-
-            DrawText("Paused",SCREEN_SIZE/2 - MeasureText("Paused", 50)/2, 150, 50,WHITE);
-
-            DrawCenteredTextInButton(btn1, "Continue", 30, BLACK);
-            DrawCenteredTextInButton(btn2, "Restart", 30, BLACK);
-            DrawCenteredTextInButton(btn3, "Menu", 30, BLACK);
-
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)){
-                Vector2 m = GetMousePosition();
-
-                if (CheckCollisionPointRec(m, btn1)) {
-                    state = PLAYING;
-                }
-                else if (CheckCollisionPointRec(m, btn2)) {
-                    memset(board, ' ', sizeof(board));
-                    gameOver = 0;
-                    winner = 0;
-                    currentPlayer = 'X';
+            if (pick == 0) {
+                state = PLAYING;
+            }
+            else if (pick == 1) {
+                memset(board, ' ', sizeof(board));
+                played.moveCount = 0;
+                aiCancel(); // a search for the old position may still be running
+                newGame = 1;
+                gameOver = 0;
+                winner = 0;
+                currentPlayer = 'X';
 
-                    state = PLAYING;
-                }
-                else if (CheckCollisionPointRec(m, btn3)) {
-                    memset(board, ' ', sizeof(board));
-                    gameOver = 0;
-                    winner = 0;
+                state = PLAYING;
+            }
+            else if (pick == 2) {
+                memset(board, ' ', sizeof(board));
+                played.moveCount = 0;
+                aiCancel(); // a search for the old position may still be running
+                newGame = 1;
+                gameOver = 0;
+                winner = 0;
 
-                    state = MENU;
+                state = MENU;
 
-                }
             }
-
         }
         // Click sound for button presses
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            PlaySound(clicksound);
+        if (clicked) {
+            PlaySound(assets.click);
+        }
+
+        // Rebuild the cached layer only if what it shows has changed
+        Scene scene;
+        memset(&scene, 0, sizeof(scene));
+        scene.state = state;
+        scene.mode = mode;
+        scene.hovered = hoveredButton(state, GetMousePosition());
+        if (state == PLAYING) {
+            scene.width = rules.width;
+            scene.height = rules.height;
+            scene.cellSize = cellSize;
+            memcpy(scene.board, board, sizeof(scene.board));
+            scene.gameOver = gameOver;
+            scene.winner = winner;
+            scene.currentPlayer = currentPlayer;
+        }
+        scene.assetsLoaded = assets.loaded;
+        int changed = memcmp(&scene, &shown, sizeof(scene)) != 0;
+        if (changed) {
+            BeginTextureMode(layer);
+            drawScene(&scene, assets.background, assets.gameover);
+            EndTextureMode();
+            shown = scene;
+            layerBuilds++;
         }
 
+        BeginDrawing();
+        // Render textures are stored upside down, hence the negative height
+        DrawTextureRec(layer.texture, (Rectangle){ 0, 0, SCREEN_SIZE, -SCREEN_SIZE }, (Vector2){ 0, 0 }, WHITE);
+        int aiBusy = aiThinking();
+        if (state == PLAYING && !gameOver && aiBusy && GetTime() - aiRequestTime > 0.15) {
+            // Animated dots while the worker searches; quick moves never show it
+            const char *dots[] = { "", ".", "..", "..." };
+            DrawText(TextFormat("AI is thinking%s", dots[(int)(GetTime() * 3) % 4]), 10, SCREEN_SIZE - 30, 20, DARKGRAY);
+        }
+
+        // Idle: with nothing to animate and no AI answer to wait for, sleep until the next input event
+        // instead of drawing TARGET_FPS identical frames a second. A frame that changed the scene is never idle,
+        // as some states move on by themselves on the next frame
+        int idle = !changed && !aiBusy && assets.loaded && !(state == PLAYING && !gameOver && currentPlayer == 'O' && mode != TWO_PLAYER);
+        if (idle != waiting) {
+            if (idle) EnableEventWaiting();
+            else DisableEventWaiting();
+            waiting = idle;
+        }
+        frames++;
         EndDrawing(); 
+        if (frames == 1) {
+            firstFrameNs = metricsNowNs() - launchNs;
+            if (poolThreadCount() < 2) poolWait(&decoding); // no worker to decode on: do it now the menu is up
+        }
     }
 
+    if (showMetrics) {
+        double seconds = GetTime() - startTime;
+        printf("frames %ld, layer rebuilds %ld in %.1f s (%.1f frames/s)\n", frames, layerBuilds, seconds,
+               seconds > 0 ? frames / seconds : 0.0);
+        printf("first frame %.1f ms after start, assets ready after %.1f ms (%s)\n", firstFrameNs / 1e6,
+               assetsReadyNs / 1e6, decodeJob.paths[0][0] ? "decoded" : "asset pack");
+    }
+    poolWait(&decoding); // closed before the decoding finished
+    aiWorkerStop();
+    gameLogClose();
+    if (nbModel != &nbTrained) nbUnmapModel(nbModel);
+    UnloadRenderTexture(layer);
+    UnloadUIAtlas();
     CloseWindow();
     return 0;
-}
\ No newline at end of file
+}
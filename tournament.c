@@ -0,0 +1,264 @@
+// Self-play tournament: every ordered pair of engines plays N games, spread over the thread pool
+// Build and run:  gcc -O2 tournament.c minimax.c minimax_improved.c naive_bayes.c threadpool.c metrics.c -lpthread -lm
+//                 -o tournament && ./tournament --games 100000
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "minimax.h"
+#include "naive_bayes.h"
+#include "rng.h"
+#include "threadpool.h"
+
+#define CELLS 9
+#define CHUNK_GAMES 1000 // games per task; each chunk has its own seed so results don't depend on the thread count
+#define MAX_ENGINES 8
+
+typedef enum { ENGINE_RANDOM, ENGINE_BASIC, ENGINE_EASY, ENGINE_MEDIUM, ENGINE_HARD, ENGINE_NB } EngineKind;
+
+static const char *engineNames[] = { "random", "basic", "easy", "medium", "hard", "nb" };
+#define ENGINE_KINDS (int)(sizeof(engineNames) / sizeof(engineNames[0]))
+
+static const int lines[8][3] = {
+    {0,1,2},{3,4,5},{6,7,8}, // rows
+    {0,3,6},{1,4,7},{2,5,8}, // columns
+    {0,4,8},{2,4,6}          // diagonals
+};
+
+static const NaiveBayesModel *nbModel = NULL;
+
+typedef struct {
+    EngineKind x, o;         // x moves first
+    unsigned long long seed;
+    int games;
+    long xWins, draws, oWins;
+} Chunk;
+
+static char winnerOf(const char *b) {
+    for (int i = 0; i < 8; i++)
+        if (b[lines[i][0]] != ' ' && b[lines[i][0]] == b[lines[i][1]] && b[lines[i][1]] == b[lines[i][2]])
+            return b[lines[i][0]];
+    return 0;
+}
+
+// Each side has its own search context; the Naive Bayes model only knows 'O', so X shows it the marks swapped
+static int engineMove(EngineKind kind, const char *b, SearchContext *ctx, Rng *rng) {
+    char board[SIZE][SIZE];
+    char *cells = &board[0][0];
+    for (int i = 0; i < CELLS; i++)
+        cells[i] = (kind != ENGINE_NB || ctx->player == 'O' || b[i] == ' ') ? b[i] : (b[i] == 'X' ? 'O' : 'X');
+
+    Move move;
+    switch (kind) {
+    case ENGINE_RANDOM: {
+        int empty[CELLS], count = 0;
+        for (int i = 0; i < CELLS; i++)
+            if (b[i] == ' ') empty[count++] = i;
+        return empty[rngRange(rng, count)];
+    }
+    case ENGINE_BASIC: move = findBestMoveBasic(ctx, board); break;
+    case ENGINE_NB: move = nbFindBestMove(nbModel, board); break;
+    default: move = findBestMove(ctx, board); break;
+    }
+    return move.row * SIZE + move.col;
+}
+
+// One task: play a chunk of games on whichever thread picks it up
+static void playChunk(void *arg) {
+    Chunk *c = arg;
+    Rng rng;
+    rngSeed(&rng, c->seed);
+    // Entries stay valid from game to game (keys include the difficulty), so the contexts are only set up
+    // once per chunk; that keeps the memset out of the hot loop
+    SearchContext *sides = malloc(2 * sizeof(*sides));
+    if (!sides) {
+        printf("Out of memory\n");
+        exit(1);
+    }
+    searchContextInit(&sides[0], 'X', c->x >= ENGINE_EASY ? (int)(c->x - ENGINE_EASY + 1) : 0, rngNext(&rng));
+    searchContextInit(&sides[1], 'O', c->o >= ENGINE_EASY ? (int)(c->o - ENGINE_EASY + 1) : 0, rngNext(&rng));
+    sides[0].memoryStats = sides[1].memoryStats = 0; // nobody reads them, and they would cost more than the search
+
+    for (int g = 0; g < c->games; g++) {
+        char b[CELLS];
+        memset(b, ' ', sizeof(b));
+        char turn = 'X', winner = 0;
+        for (int ply = 0; ply < CELLS && !winner; ply++) {
+            int cell = engineMove(turn == 'X' ? c->x : c->o, b, &sides[turn == 'O'], &rng);
+            b[cell] = turn;
+            winner = winnerOf(b);
+            turn = (turn == 'X') ? 'O' : 'X';
+        }
+        if (winner == 'X') c->xWins++;
+        else if (winner == 'O') c->oWins++;
+        else c->draws++;
+    }
+    free(sides);
+}
+
+// 95% Wilson score interval of a proportion
+static void wilson(long k, long n, double *low, double *high) {
+    const double z = 1.96;
+    double p = (double)k / n, z2n = z * z / n;
+    double center = (p + z2n / 2) / (1 + z2n);
+    double half = z * sqrt(p * (1 - p) / n + z2n / (4.0 * n)) / (1 + z2n);
+    *low = center - half;
+    *high = center + half;
+}
+
+static int engineByName(const char *name) {
+    for (int i = 0; i < ENGINE_KINDS; i++)
+        if (strcmp(engineNames[i], name) == 0) return i;
+    return -1;
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [--games N] [--threads N] [--seed N] [--engines a,b,...] [--model path] [--format text|csv|json]\n", prog);
+    printf("  engines: random, basic, easy, medium, hard, nb (default: all). Every ordered pair plays N games\n");
+    printf("  --threads 0 uses one thread per core\n");
+}
+
+int main(int argc, char **argv) {
+    long gamesPerPair = 10000;
+    int threads = 0;
+    unsigned long long seed = 12345;
+    const char *modelPath = "tic-tac-toe.nbm";
+    MetricsFormat format = METRICS_TEXT;
+    int engines[MAX_ENGINES], engineCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            gamesPerPair = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            modelPath = argv[++i];
+        } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "csv") == 0) format = METRICS_CSV;
+            else if (strcmp(argv[i], "json") == 0) format = METRICS_JSON;
+            else if (strcmp(argv[i], "text") == 0) format = METRICS_TEXT;
+            else { usage(argv[0]); return 1; }
+        } else if (strcmp(argv[i], "--engines") == 0 && i + 1 < argc) {
+            char list[128];
+            snprintf(list, sizeof(list), "%s", argv[++i]);
+            for (char *name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+                int kind = engineByName(name);
+                if (kind < 0 || engineCount == MAX_ENGINES) {
+                    printf("Unknown engine: %s\n", name);
+                    return 1;
+                }
+                engines[engineCount++] = kind;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (engineCount == 0)
+        for (int k = 0; k < ENGINE_KINDS; k++) engines[engineCount++] = k;
+    if (gamesPerPair < 1 || engineCount < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Naive Bayes: the exported model, else train from the data set
+    for (int e = 0; e < engineCount; e++) {
+        if (engines[e] != ENGINE_NB || nbModel) continue;
+        nbModel = nbMapModel(modelPath);
+        if (!nbModel) {
+            static NaiveBayesModel trained;
+            if (!nbTrain(&trained, "tic-tac-toe.data")) return 1;
+            nbModel = &trained;
+        }
+    }
+
+    int pairCount = engineCount * (engineCount - 1);
+    int chunksPerPair = (int)((gamesPerPair + CHUNK_GAMES - 1) / CHUNK_GAMES);
+    Chunk *chunks = calloc((size_t)pairCount * chunksPerPair, sizeof(Chunk));
+    if (!chunks) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    // Seed every chunk from the run seed, pair and chunk number
+    Rng seeder;
+    rngSeed(&seeder, seed);
+    int n = 0;
+    for (int a = 0; a < engineCount; a++) {
+        for (int b = 0; b < engineCount; b++) {
+            if (a == b) continue;
+            for (int k = 0; k < chunksPerPair; k++, n++) {
+                chunks[n].x = engines[a];
+                chunks[n].o = engines[b];
+                chunks[n].seed = rngNext(&seeder);
+                chunks[n].games = (int)(k < chunksPerPair - 1 ? CHUNK_GAMES : gamesPerPair - (long)k * CHUNK_GAMES);
+            }
+        }
+    }
+
+    poolInit(threads);
+    unsigned long long start = metricsNowNs();
+    TaskGroup group;
+    taskGroupInit(&group);
+    for (int i = 0; i < n; i++) poolSpawn(&group, playChunk, &chunks[i]);
+    poolWait(&group);
+    double seconds = (metricsNowNs() - start) / 1e9;
+    long totalGames = gamesPerPair * pairCount;
+
+    if (format == METRICS_CSV)
+        printf("x,o,games,x_wins,draws,o_wins,x_win_low,x_win_high,draw_low,draw_high,o_win_low,o_win_high\n");
+    else if (format == METRICS_TEXT)
+        printf("%-8s %-8s %10s %22s %22s %22s\n", "X", "O", "games", "X wins [95% CI]", "draws [95% CI]", "O wins [95% CI]");
+
+    // Sum the chunks of each pair in order
+    for (int p = 0; p < pairCount; p++) {
+        long xWins = 0, draws = 0, oWins = 0;
+        for (int k = 0; k < chunksPerPair; k++) {
+            const Chunk *c = &chunks[p * chunksPerPair + k];
+            xWins += c->xWins;
+            draws += c->draws;
+            oWins += c->oWins;
+        }
+        const Chunk *first = &chunks[p * chunksPerPair];
+        const char *x = engineNames[first->x], *o = engineNames[first->o];
+        double ci[3][2];
+        wilson(xWins, gamesPerPair, &ci[0][0], &ci[0][1]);
+        wilson(draws, gamesPerPair, &ci[1][0], &ci[1][1]);
+        wilson(oWins, gamesPerPair, &ci[2][0], &ci[2][1]);
+
+        switch (format) {
+        case METRICS_CSV:
+            printf("%s,%s,%ld,%ld,%ld,%ld,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n", x, o, gamesPerPair, xWins, draws, oWins,
+                   ci[0][0], ci[0][1], ci[1][0], ci[1][1], ci[2][0], ci[2][1]);
+            break;
+        case METRICS_JSON:
+            printf("{\"x\":\"%s\",\"o\":\"%s\",\"games\":%ld,\"x_wins\":%ld,\"draws\":%ld,\"o_wins\":%ld,"
+                   "\"x_win_ci\":[%.6f,%.6f],\"draw_ci\":[%.6f,%.6f],\"o_win_ci\":[%.6f,%.6f]}\n", x, o, gamesPerPair,
+                   xWins, draws, oWins, ci[0][0], ci[0][1], ci[1][0], ci[1][1], ci[2][0], ci[2][1]);
+            break;
+        default: {
+            char cell[3][32];
+            long counts[3] = { xWins, draws, oWins };
+            for (int r = 0; r < 3; r++)
+                snprintf(cell[r], sizeof(cell[r]), "%5.1f%% [%5.1f, %5.1f]", 100.0 * counts[r] / gamesPerPair,
+                         100 * ci[r][0], 100 * ci[r][1]);
+            printf("%-8s %-8s %10ld %22s %22s %22s\n", x, o, gamesPerPair, cell[0], cell[1], cell[2]);
+            break;
+        }
+        }
+    }
+
+    if (format == METRICS_JSON)
+        printf("{\"games\":%ld,\"threads\":%d,\"seconds\":%.3f,\"games_per_sec\":%.0f}\n", totalGames, poolThreadCount(),
+               seconds, totalGames / seconds);
+    else if (format == METRICS_TEXT)
+        printf("\n%ld games on %d threads in %.2lf s: %.0f games/s\n", totalGames, poolThreadCount(), seconds,
+               totalGames / seconds);
+
+    poolShutdown();
+    free(chunks);
+    return 0;
+}
@@ -1,4 +1,6 @@
+#include <string.h>
 #include "raylib.h"
+#include "rlgl.h"
 #include "ui.h"
 
 // Internal UI settings and colors
@@ -11,6 +13,25 @@ static float hoverGlow;
 static float roundness;
 static int segments;
 
+// Sprite atlas, see BuildUIAtlas
+#define ATLAS_WIDTH 1024
+#define ATLAS_PADDING 2
+#define ATLAS_MAX_TEXTS 64
+
+typedef struct {
+    char text[32];
+    int fontSize;
+    Color color;
+    Rectangle rec; // where it sits in the atlas, in texture mode coordinates
+} AtlasText;
+
+static AtlasText atlasTexts[ATLAS_MAX_TEXTS];
+static int atlasTextCount = 0;
+static RenderTexture2D atlas;
+static bool atlasReady = false;
+static Rectangle atlasButtons[2]; // normal, hovered; each includes room for the hover glow
+static float atlasButtonWidth, atlasButtonHeight;
+
 
 void InitUI()
 {
@@ -30,7 +51,7 @@ void InitUI()
     segments  = 16;
 }
 
-void DrawButton(Rectangle btn, bool hovered)
+static void DrawButtonShapes(Rectangle btn, bool hovered)
 {
     float glow = hovered ? hoverGlow : baseGlow;
     Color glowColor = hovered ? glowColorHover : glowColorBase;
@@ -52,12 +73,120 @@ void DrawButton(Rectangle btn, bool hovered)
     DrawRectangleRounded(btn, roundness, segments, btnColor);
 }
 
+// Render textures are stored upside down: flip the source rectangle when drawing from one
+static void DrawAtlasRec(Rectangle rec, float x, float y)
+{
+    Rectangle source = { rec.x, atlas.texture.height - rec.y - rec.height, rec.width, -rec.height };
+    DrawTextureRec(atlas.texture, source, (Vector2){ x, y }, WHITE);
+}
+
+static const AtlasText *LookupText(const char* text, int fontSize, Color color)
+{
+    for (int i = 0; i < atlasTextCount; i++) {
+        const AtlasText *t = &atlasTexts[i];
+        if (t->fontSize == fontSize && t->color.r == color.r && t->color.g == color.g && t->color.b == color.b &&
+            t->color.a == color.a && strcmp(t->text, text) == 0)
+            return t;
+    }
+    return NULL;
+}
+
+static const AtlasText *FindAtlasText(const char* text, int fontSize, Color color)
+{
+    return atlasReady ? LookupText(text, fontSize, color) : NULL;
+}
+
+void AddAtlasText(const char* text, int fontSize, Color color)
+{
+    if (atlasReady || atlasTextCount == ATLAS_MAX_TEXTS || strlen(text) >= sizeof(atlasTexts[0].text)) return;
+    if (LookupText(text, fontSize, color)) return;
+    AtlasText *t = &atlasTexts[atlasTextCount++];
+    strcpy(t->text, text);
+    t->fontSize = fontSize;
+    t->color = color;
+}
+
+// Shelf packing: left to right, a new row when the current one is full
+static Rectangle PlaceInAtlas(float width, float height, float *x, float *y, float *rowHeight)
+{
+    if (*x + width > ATLAS_WIDTH) {
+        *x = 0;
+        *y += *rowHeight + ATLAS_PADDING;
+        *rowHeight = 0;
+    }
+    Rectangle rec = { *x, *y, width, height };
+    *x += width + ATLAS_PADDING;
+    if (height > *rowHeight) *rowHeight = height;
+    return rec;
+}
+
+void BuildUIAtlas(int buttonWidth, int buttonHeight)
+{
+    if (atlasReady) return;
+    atlasButtonWidth = buttonWidth;
+    atlasButtonHeight = buttonHeight;
+
+    float x = 0, y = 0, rowHeight = 0;
+    for (int i = 0; i < 2; i++)
+        atlasButtons[i] = PlaceInAtlas(buttonWidth + hoverGlow, buttonHeight + hoverGlow, &x, &y, &rowHeight);
+    for (int i = 0; i < atlasTextCount; i++)
+        atlasTexts[i].rec = PlaceInAtlas(MeasureText(atlasTexts[i].text, atlasTexts[i].fontSize),
+                                         atlasTexts[i].fontSize, &x, &y, &rowHeight);
+
+    atlas = LoadRenderTexture(ATLAS_WIDTH, (int)(y + rowHeight));
+    if (atlas.id == 0) return; // no atlas: everything keeps drawing the slow way
+    BeginTextureMode(atlas);
+    ClearBackground(BLANK);
+    for (int i = 0; i < 2; i++) {
+        Rectangle btn = { atlasButtons[i].x + hoverGlow/2, atlasButtons[i].y + hoverGlow/2, buttonWidth, buttonHeight };
+        // The glow is translucent and there is nothing under it yet: store its color as is instead of blending
+        // it with the transparent background, or it comes out fainter when the sprite is drawn
+        rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM);
+        float glow = i ? hoverGlow : baseGlow;
+        DrawRectangleRounded((Rectangle){ btn.x - glow/2, btn.y - glow/2, btn.width + glow, btn.height + glow },
+                             roundness, segments, i ? glowColorHover : glowColorBase);
+        EndBlendMode();
+        DrawRectangleRounded(btn, roundness, segments, btnColor);
+    }
+    // The default font's pixels are either solid or empty, so normal blending stores text exactly
+    for (int i = 0; i < atlasTextCount; i++)
+        DrawText(atlasTexts[i].text, atlasTexts[i].rec.x, atlasTexts[i].rec.y, atlasTexts[i].fontSize,
+                 atlasTexts[i].color);
+    EndTextureMode();
+    atlasReady = true;
+}
+
+void UnloadUIAtlas()
+{
+    if (!atlasReady) return;
+    UnloadRenderTexture(atlas);
+    atlasReady = false;
+}
+
+void DrawButton(Rectangle btn, bool hovered)
+{
+    if (atlasReady && btn.width == atlasButtonWidth && btn.height == atlasButtonHeight)
+        DrawAtlasRec(atlasButtons[hovered ? 1 : 0], btn.x - hoverGlow/2, btn.y - hoverGlow/2);
+    else
+        DrawButtonShapes(btn, hovered);
+}
+
+void DrawUIText(const char* text, int x, int y, int fontSize, Color color)
+{
+    const AtlasText *t = FindAtlasText(text, fontSize, color);
+    if (t) DrawAtlasRec(t->rec, x, y);
+    else DrawText(text, x, y, fontSize, color);
+}
+
 void DrawCenteredTextInButton(Rectangle btn, const char* text, int fontSize, Color color)
 {
-    int textWidth = MeasureText(text, fontSize);
+    const AtlasText *t = FindAtlasText(text, fontSize, color);
+    int textWidth = t ? (int)t->rec.width : MeasureText(text, fontSize);
 
     int x = btn.x + (btn.width  - textWidth) / 2;
     int y = btn.y + (btn.height - fontSize) / 2;
 
-    DrawText(text, x, y, fontSize, color);
-}
\ No newline at end of file
+    if (t) DrawAtlasRec(t->rec, x, y);
+    else DrawText(text, x, y, fontSize, color);
+}
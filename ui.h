@@ -7,4 +7,12 @@ void InitUI();  // call once to load colors, settings
 void DrawButton(Rectangle btn, bool hovered);
 void DrawCenteredTextInButton(Rectangle btn, const char* text, int fontSize, Color color);
 
+// Sprite atlas: button states and registered texts are rendered once into one texture, so drawing them
+// is a single textured quad instead of tessellated shapes and per-glyph text. Register the texts after
+// InitUI, then build once (needs the window). Anything not in the atlas falls back to the shapes and DrawText
+void AddAtlasText(const char* text, int fontSize, Color color);
+void BuildUIAtlas(int buttonWidth, int buttonHeight);
+void UnloadUIAtlas();
+void DrawUIText(const char* text, int x, int y, int fontSize, Color color); // DrawText, from the atlas when possible
+
 #endif
\ No newline at end of file